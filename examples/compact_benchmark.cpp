@@ -0,0 +1,156 @@
+#include "datapod/datapod.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::usize sink;
+
+// A typical radio-link message: small integers, short strings, short vectors
+struct Waypoint {
+    datapod::i32 x;
+    datapod::i32 y;
+    datapod::u16 speed;
+};
+
+struct Status {
+    datapod::u32 seq;
+    datapod::u64 stamp;
+    datapod::u8 mode;
+    float battery;
+    String vehicle;
+    Vector<Waypoint> route;
+    Vector<datapod::u16> faults;
+    Map<datapod::u32, String> labels;
+};
+
+// A bulk-float payload, where compact encoding has little to win
+struct Cloud {
+    datapod::u32 id;
+    Vector<float> points;
+};
+
+int main() {
+    std::cout << "=== Compact Encoding Benchmark ===\n\n";
+
+    // 1. Small status messages
+    {
+        std::cout << "1. Status message (8 waypoints, 2 faults, 2 labels):\n";
+        Status s{};
+        s.seq = 1234;
+        s.stamp = 1700000000ULL;
+        s.mode = 2;
+        s.battery = 0.87f;
+        s.vehicle = String("rover-7");
+        for (datapod::i32 i = 0; i < 8; ++i) {
+            s.route.push_back({i * 10 - 40, 25 - i * 5, static_cast<datapod::u16>(120 + i)});
+        }
+        s.faults.push_back(3);
+        s.faults.push_back(17);
+        s.labels.insert({1U, String("dock")});
+        s.labels.insert({2U, String("field")});
+
+        constexpr int ROUNDS = 200000;
+        auto const default_size = serialize(s).size();
+        auto const compact_size = serialize<Mode::COMPACT>(s).size();
+
+        auto const ser_default = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                sink = serialize(s).size();
+            }
+        });
+        auto const ser_compact = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                sink = serialize<Mode::COMPACT>(s).size();
+            }
+        });
+
+        auto const default_buf = serialize(s);
+        auto const compact_buf = serialize<Mode::COMPACT>(s);
+        auto const de_default = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                sink = deserialize<Mode::NONE, Status>(default_buf).route.size();
+            }
+        });
+        auto const de_compact = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                sink = deserialize<Mode::COMPACT, Status>(compact_buf).route.size();
+            }
+        });
+
+        std::cout << "   default: " << default_size << " B, serialize " << ser_default * 1e6 / ROUNDS
+                  << " ns, deserialize " << de_default * 1e6 / ROUNDS << " ns\n";
+        std::cout << "   COMPACT: " << compact_size << " B, serialize " << ser_compact * 1e6 / ROUNDS
+                  << " ns, deserialize " << de_compact * 1e6 / ROUNDS << " ns\n";
+        std::cout << "   size ratio: " << static_cast<double>(compact_size) / static_cast<double>(default_size)
+                  << "\n\n";
+    }
+
+    // 2. Bulk floats still go out as one block copy
+    {
+        std::cout << "2. Cloud (1M floats):\n";
+        Cloud c{1, {}};
+        c.points.resize(1000000);
+        for (datapod::usize i = 0; i < c.points.size(); ++i) {
+            c.points[i] = static_cast<float>(i);
+        }
+
+        constexpr int ROUNDS = 20;
+        auto const default_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize(c);
+                sink = deserialize<Mode::NONE, Cloud>(buf).points.size();
+            }
+        });
+        auto const compact_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize<Mode::COMPACT>(c);
+                sink = deserialize<Mode::COMPACT, Cloud>(buf).points.size();
+            }
+        });
+
+        std::cout << "   default: " << serialize(c).size() << " B, " << default_ms / ROUNDS << " ms per round trip\n";
+        std::cout << "   COMPACT: " << serialize<Mode::COMPACT>(c).size() << " B, " << compact_ms / ROUNDS
+                  << " ms per round trip\n\n";
+    }
+
+    // 3. Integer-heavy vectors pay for the per-element varint coding
+    {
+        std::cout << "3. Vector<u32> (1M small values):\n";
+        Vector<datapod::u32> ids(1000000);
+        for (datapod::usize i = 0; i < ids.size(); ++i) {
+            ids[i] = static_cast<datapod::u32>(i % 1000U);
+        }
+
+        constexpr int ROUNDS = 20;
+        auto const default_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize(ids);
+                sink = deserialize<Mode::NONE, Vector<datapod::u32>>(buf).size();
+            }
+        });
+        auto const compact_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize<Mode::COMPACT>(ids);
+                sink = deserialize<Mode::COMPACT, Vector<datapod::u32>>(buf).size();
+            }
+        });
+
+        std::cout << "   default: " << serialize(ids).size() << " B, " << default_ms / ROUNDS
+                  << " ms per round trip\n";
+        std::cout << "   COMPACT: " << serialize<Mode::COMPACT>(ids).size() << " B, " << compact_ms / ROUNDS
+                  << " ms per round trip\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include "datapod/pods/lockfree/concurrent_map.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::u64 sink;
+
+struct TrackState {
+    datapod::u64 id;
+    double x, y, vx, vy;
+    datapod::u32 hits;
+};
+
+// A Map behind one mutex: what sharing a table costs today
+struct LockedMap {
+    Optional<TrackState> get(datapod::u64 key) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return map_.get(key);
+    }
+    void insert_or_assign(datapod::u64 key, const TrackState &value) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        map_.insert_or_assign(key, value);
+    }
+
+    std::mutex mutex_;
+    Map<datapod::u64, TrackState> map_;
+};
+
+constexpr datapod::u64 KEYS = 100000;
+constexpr datapod::u64 TOTAL_OPS = 2000000;
+
+// `threads` threads share TOTAL_OPS operations on random keys, `writes_per_100` of them writes; returns Mops/s
+template <typename MapT> double run(MapT &map, int threads, int writes_per_100) {
+    auto const ms = measure_ms([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                datapod::u64 state = 0x9E3779B97F4A7C15ULL * static_cast<datapod::u64>(t + 1);
+                datapod::u64 sum = 0;
+                for (datapod::u64 i = 0; i < TOTAL_OPS / static_cast<datapod::u64>(threads); ++i) {
+                    state ^= state << 13U;
+                    state ^= state >> 7U;
+                    state ^= state << 17U;
+                    auto const key = state % KEYS;
+                    if (static_cast<int>((state >> 32U) % 100U) < writes_per_100) {
+                        map.insert_or_assign(key, TrackState{key, 1.0, 2.0, 0.1, 0.2, static_cast<datapod::u32>(i)});
+                    } else {
+                        auto const v = map.get(key);
+                        sum += v.has_value() ? v->hits : 0U;
+                    }
+                }
+                sink = sum;
+            });
+        }
+        for (auto &w : workers) {
+            w.join();
+        }
+    });
+    return static_cast<double>(TOTAL_OPS) / (ms * 1e3);
+}
+
+int main() {
+    std::cout << "=== Concurrent Map Benchmark ===\n";
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << ", " << KEYS << " keys\n";
+
+    struct Mix {
+        char const *name;
+        int writes_per_100;
+    };
+    for (auto const mix : {Mix{"read-heavy (95% get, 5% insert_or_assign)", 5},
+                           Mix{"write-heavy (50% get, 50% insert_or_assign)", 50}}) {
+        std::cout << "\n" << mix.name << ", Mops/s:\n";
+        std::cout << "   threads   mutex+Map   ConcurrentMap\n";
+        for (int threads : {1, 2, 4, 8, 16, 32}) {
+            LockedMap locked;
+            ConcurrentMap<datapod::u64, TrackState> sharded;
+            for (datapod::u64 k = 0; k < KEYS; ++k) {
+                locked.insert_or_assign(k, TrackState{k, 0.0, 0.0, 0.0, 0.0, 0U});
+                sharded.insert_or_assign(k, TrackState{k, 0.0, 0.0, 0.0, 0.0, 0U});
+            }
+            auto const locked_mops = run(locked, threads, mix.writes_per_100);
+            auto const sharded_mops = run(sharded, threads, mix.writes_per_100);
+            std::cout << "   " << threads << "\t     " << locked_mops << "\t " << sharded_mops << "\n";
+        }
+    }
+
+    return 0;
+}
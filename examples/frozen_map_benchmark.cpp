@@ -0,0 +1,73 @@
+#include "datapod/datapod.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::u64 sink;
+
+// Freezes an n-entry Map and compares lookups (half present, random order) and table size; prints ns per key
+void run(datapod::usize n, datapod::usize lookups) {
+    using M = Map<datapod::u64, datapod::u64>;
+    M map;
+    std::mt19937_64 rng{1};
+    std::vector<datapod::u64> stored(n);
+    for (datapod::usize i = 0; i < n; ++i) {
+        stored[i] = rng();
+        map[stored[i]] = i;
+    }
+    std::vector<datapod::u64> keys(lookups);
+    for (datapod::usize i = 0; i < lookups; ++i) {
+        keys[i] = (i % 2U == 0U) ? stored[rng() % n] : rng();
+    }
+
+    FrozenMap<datapod::u64, datapod::u64> frozen;
+    auto const build_ms = measure_ms([&] { frozen = frozen_map::make(map); });
+
+    datapod::u64 sum = 0;
+    auto const map_ms = measure_ms([&] {
+        for (auto const k : keys) {
+            auto const it = map.find(k);
+            sum += it == map.end() ? 0U : it->second;
+        }
+    });
+    auto const frozen_ms = measure_ms([&] {
+        for (auto const k : keys) {
+            auto const it = frozen.find(k);
+            sum += it == frozen.end() ? 0U : it->second;
+        }
+    });
+    sink = sum;
+
+    auto const kib = [](datapod::usize bytes) { return static_cast<double>(bytes) / 1024.0; };
+    auto const map_bytes = map.capacity() * (sizeof(M::entry_t) + 1U);
+    auto const frozen_bytes = frozen.size() * sizeof(frozen.entries_[0]) + frozen.pilots_.size() * sizeof(datapod::u32);
+    auto const per_key = [lookups](double ms) { return ms * 1e6 / static_cast<double>(lookups); };
+    std::cout << "   " << n << " entries (freeze took " << build_ms << " ms):\n";
+    std::cout << "     Map:        " << per_key(map_ms) << " ns, " << kib(map_bytes) << " KiB\n";
+    std::cout << "     FrozenMap:  " << per_key(frozen_ms) << " ns, " << kib(frozen_bytes) << " KiB\n";
+}
+
+int main() {
+    std::cout << "=== Frozen Map Benchmark ===\n\n";
+
+    std::cout << "1. Cache-resident table:\n";
+    run(10000, 2000000);
+
+    std::cout << "\n2. Table larger than the last-level cache:\n";
+    run(4000000, 4000000);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "datapod/datapod.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile hash_t sink;
+
+struct Cloud {
+    datapod::u32 id;
+    Vector<float> points;
+};
+
+int main() {
+    std::cout << "=== Hash Throughput Benchmark ===\n\n";
+
+    // 1. Raw throughput over buffers of increasing size
+    {
+        std::cout << "1. FNV-1a vs XXH64 (GB/s):\n";
+        std::vector<char> data(64U * 1024U * 1024U);
+        for (datapod::usize i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<char>(i * 131U);
+        }
+
+        for (datapod::usize size : {16U, 64U, 1024U, 64U * 1024U, 64U * 1024U * 1024U}) {
+            auto const iterations = data.size() / size;
+            auto const total_gb = static_cast<double>(iterations * size) / 1e9;
+
+            auto const fnv_ms = measure_ms([&] {
+                hash_t h = 0;
+                for (datapod::usize i = 0; i < iterations; ++i) {
+                    h ^= hash(std::string_view{data.data() + i * size, size});
+                }
+                sink = h;
+            });
+            auto const xxh_ms = measure_ms([&] {
+                hash_t h = 0;
+                for (datapod::usize i = 0; i < iterations; ++i) {
+                    h ^= hash_bulk(data.data() + i * size, size);
+                }
+                sink = h;
+            });
+
+            std::cout << "   " << size << " B: FNV " << total_gb / (fnv_ms / 1e3) << "  XXH64 "
+                      << total_gb / (xxh_ms / 1e3) << "  (" << fnv_ms / xxh_ms << "x)\n";
+        }
+        std::cout << "\n";
+    }
+
+    // 2. End-to-end serialization with an integrity checksum
+    {
+        std::cout << "2. serialize/deserialize with WITH_INTEGRITY (1M floats):\n";
+        Cloud c{1, {}};
+        c.points.resize(1000000);
+        for (datapod::usize i = 0; i < c.points.size(); ++i) {
+            c.points[i] = static_cast<float>(i);
+        }
+
+        constexpr auto XXH = Mode::WITH_INTEGRITY;
+        constexpr auto FNV = Mode::WITH_INTEGRITY | Mode::FNV_INTEGRITY;
+        constexpr int ROUNDS = 20;
+
+        auto const fnv_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize<FNV>(c);
+                sink = deserialize<FNV, Cloud>(buf).id;
+            }
+        });
+        auto const xxh_ms = measure_ms([&] {
+            for (int i = 0; i < ROUNDS; ++i) {
+                auto buf = serialize<XXH>(c);
+                sink = deserialize<XXH, Cloud>(buf).id;
+            }
+        });
+
+        std::cout << "   FNV_INTEGRITY: " << fnv_ms / ROUNDS << " ms per round trip\n";
+        std::cout << "   default:       " << xxh_ms / ROUNDS << " ms per round trip\n\n";
+    }
+
+    // 3. String-keyed map lookups
+    {
+        std::cout << "3. Map<String, int> lookups (100k keys):\n";
+        constexpr int N = 100000;
+        std::vector<String> keys;
+        Map<String, int> m;
+        for (int i = 0; i < N; ++i) {
+            keys.emplace_back(("sensor/frame/" + std::to_string(i)).c_str());
+            m[keys.back()] = i;
+        }
+
+        auto const ms = measure_ms([&] {
+            hash_t found = 0;
+            for (int r = 0; r < 10; ++r) {
+                for (auto const &k : keys) {
+                    found += static_cast<hash_t>(m.at(k));
+                }
+            }
+            sink = found;
+        });
+        std::cout << "   " << ms << " ms for " << 10 * N << " lookups\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "datapod/datapod.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::u64 sink;
+
+// Looks up `keys` (half of them present, in random order) one at a time and in batches; prints ns per key
+void run(datapod::usize capacity, datapod::usize lookups) {
+    using M = Map<datapod::u64, datapod::u64>;
+    auto const n = capacity * 3U / 4U;
+    M map;
+    map.reserve(capacity);
+    std::mt19937_64 rng{1};
+    for (datapod::usize i = 0; i < n; ++i) {
+        map[rng()] = i;
+    }
+
+    // Replaying the generator gives present keys; fresh draws are (almost surely) absent
+    std::mt19937_64 replay{1};
+    std::vector<datapod::u64> stored(n);
+    for (auto &k : stored) {
+        k = replay();
+    }
+    std::vector<datapod::u64> keys(lookups);
+    for (datapod::usize i = 0; i < lookups; ++i) {
+        keys[i] = (i % 2U == 0U) ? stored[rng() % n] : rng();
+    }
+
+    auto const table_mb = static_cast<double>(capacity * (sizeof(M::entry_t) + 1U)) / (1024.0 * 1024.0);
+    std::cout << "   " << table_mb << " MiB table, " << lookups << " lookups:\n";
+
+    datapod::u64 sum = 0;
+    auto const find_ms = measure_ms([&] {
+        for (auto const k : keys) {
+            auto const it = map.find(k);
+            sum += it == map.end() ? 0U : it->second;
+        }
+    });
+    std::vector<M::iterator> found(lookups);
+    auto const find_batch_ms = measure_ms([&] {
+        map.find_batch(keys, found);
+        for (auto const &it : found) {
+            sum += it == map.end() ? 0U : it->second;
+        }
+    });
+
+    datapod::usize hits = 0;
+    auto const contains_ms = measure_ms([&] {
+        for (auto const k : keys) {
+            hits += map.contains(k) ? 1U : 0U;
+        }
+    });
+    auto present = std::make_unique<bool[]>(lookups);
+    auto const contains_batch_ms =
+        measure_ms([&] { hits += map.contains_batch(keys, std::span<bool>(present.get(), lookups)); });
+    sink = sum + hits;
+
+    auto const per_key = [lookups](double ms) { return ms * 1e6 / static_cast<double>(lookups); };
+    std::cout << "     find:            " << per_key(find_ms) << " ns\n";
+    std::cout << "     find_batch:      " << per_key(find_batch_ms) << " ns  (" << find_ms / find_batch_ms << "x)\n";
+    std::cout << "     contains:        " << per_key(contains_ms) << " ns\n";
+    std::cout << "     contains_batch:  " << per_key(contains_batch_ms) << " ns  ("
+              << contains_ms / contains_batch_ms << "x)\n";
+}
+
+int main(int argc, char **argv) {
+    std::cout << "=== Hash Map Batch Lookup Benchmark ===\n\n";
+
+    // Default large table is 2^25 slots (~544 MiB); pass log2(capacity) to change it
+    auto const log2_large = argc > 1 ? std::atoi(argv[1]) : 25;
+
+    std::cout << "1. Cache-resident table:\n";
+    run((datapod::usize{1} << 14U) - 1U, 1000000);
+
+    std::cout << "\n2. Table larger than the last-level cache:\n";
+    run((datapod::usize{1} << log2_large) - 1U, 4000000);
+
+    return 0;
+}
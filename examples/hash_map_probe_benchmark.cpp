@@ -0,0 +1,81 @@
+#include "datapod/datapod.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::u64 sink;
+
+// Fills a table reserved to `capacity` slots up to load factor `lf`, then looks up every stored key
+// and as many absent keys; prints ns per insert, hit and miss
+template <typename K, typename MakeKey>
+void run(char const *name, datapod::usize capacity, MakeKey &&make_key, std::initializer_list<double> factors) {
+    std::cout << name << " (capacity " << capacity << ", ns/op):\n";
+    std::cout << "   load    insert    hit      miss\n";
+    for (double lf : factors) {
+        auto const n = static_cast<datapod::usize>(static_cast<double>(capacity) * lf);
+        std::vector<K> present;
+        std::vector<K> absent;
+        present.reserve(n);
+        absent.reserve(n);
+        for (datapod::usize i = 0; i < n; ++i) {
+            present.push_back(make_key(2 * i));
+            absent.push_back(make_key(2 * i + 1));
+        }
+
+        Map<K, datapod::u64> map;
+        map.reserve(capacity);
+        auto const insert_ms = measure_ms([&] {
+            for (datapod::usize i = 0; i < n; ++i) {
+                map[present[i]] = i;
+            }
+        });
+
+        datapod::u64 sum = 0;
+        auto const hit_ms = measure_ms([&] {
+            for (auto const &k : present) {
+                sum += map.find(k)->second;
+            }
+        });
+        auto const miss_ms = measure_ms([&] {
+            for (auto const &k : absent) {
+                sum += map.find(k) == map.end() ? 0U : 1U;
+            }
+        });
+        sink = sum;
+
+        auto const per_op = [n](double ms) { return ms * 1e6 / static_cast<double>(n); };
+        std::cout << "   " << lf << "\t   " << per_op(insert_ms) << "\t    " << per_op(hit_ms) << "\t     "
+                  << per_op(miss_ms) << (map.capacity() == capacity ? "" : "  (table grew)") << "\n";
+    }
+}
+
+int main() {
+    std::cout << "=== Hash Map Probe Benchmark ===\n";
+    std::cout << "control group width: " << Map<datapod::u64, datapod::u64>::WIDTH << " slots\n\n";
+
+    auto const factors = {0.5, 0.625, 0.75, 0.8125, 0.875};
+
+    // Capacities are 2^k - 1 (Swiss tables use the capacity as the probe mask)
+    run<datapod::u64>(
+        "1. Map<u64, u64>", (1U << 20U) - 1U, [](datapod::usize i) { return static_cast<datapod::u64>(i); }, factors);
+
+    std::cout << "\n";
+    run<String>(
+        "2. Map<String, u64>", (1U << 18U) - 1U,
+        [](datapod::usize i) { return String(("sensor/" + std::to_string(i) + "/value").c_str()); }, factors);
+
+    return 0;
+}
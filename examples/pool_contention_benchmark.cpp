@@ -0,0 +1,180 @@
+#include "datapod/pods/lockfree/ring_buffer.hpp"
+#include "datapod/pods/memory/concurrent_pool.hpp"
+#include "datapod/pods/memory/pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile datapod::u64 sink;
+
+struct Message {
+    datapod::u64 seq;
+    datapod::u64 payload[15];
+};
+
+// The single-threaded Pool shared behind a mutex: what a thread-safe Pool costs today
+struct LockedPool {
+    Message *allocate() {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return pool_.allocate(1);
+    }
+    void deallocate(Message *m) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        pool_.deallocate(m, 1);
+    }
+
+    std::mutex mutex_;
+    Pool<Message> pool_;
+};
+
+// One driver allocates N messages and hands them to `workers` threads that free them, returns Mops/s
+// make_alloc() / make_free() return the per-thread allocate and free functions
+template <typename MakeAlloc, typename MakeFree>
+double pipeline(int workers, datapod::u64 n, MakeAlloc &&make_alloc, MakeFree &&make_free) {
+    RingBuffer<MPMC, Message *> queue(1024);
+    std::atomic<datapod::u64> freed{0};
+
+    auto const ms = measure_ms([&] {
+        std::vector<std::thread> threads;
+        for (int w = 0; w < workers; ++w) {
+            threads.emplace_back([&] {
+                auto release = make_free();
+                datapod::u64 sum = 0;
+                while (freed.load(std::memory_order_relaxed) < n) {
+                    auto m = queue.try_pop();
+                    if (!m.has_value()) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    sum += (*m)->seq;
+                    release(*m);
+                    freed.fetch_add(1, std::memory_order_relaxed);
+                }
+                sink = sum;
+            });
+        }
+
+        auto alloc = make_alloc();
+        for (datapod::u64 i = 0; i < n; ++i) {
+            Message *m = alloc();
+            m->seq = i;
+            while (!queue.try_push(m)) {
+                std::this_thread::yield();
+            }
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+    });
+    return static_cast<double>(n) / (ms * 1e3);
+}
+
+int main() {
+    std::cout << "=== Pool Contention Benchmark ===\n";
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    // 1. Allocate and free on one thread, the case the single-threaded Pool is built for
+    {
+        constexpr int ROUNDS = 2000;
+        constexpr int BATCH = 1000;
+        std::vector<Message *> live(BATCH);
+        std::cout << "1. Same-thread alloc/free (ns per pair):\n";
+
+        auto const malloc_ms = measure_ms([&] {
+            for (int r = 0; r < ROUNDS; ++r) {
+                for (auto &m : live) {
+                    m = static_cast<Message *>(std::malloc(sizeof(Message)));
+                    m->seq = static_cast<datapod::u64>(r);
+                }
+                for (auto *m : live) {
+                    std::free(m);
+                }
+            }
+        });
+
+        Pool<Message> pool;
+        auto const pool_ms = measure_ms([&] {
+            for (int r = 0; r < ROUNDS; ++r) {
+                for (auto &m : live) {
+                    m = pool.allocate(1);
+                    m->seq = static_cast<datapod::u64>(r);
+                }
+                for (auto *m : live) {
+                    pool.deallocate(m, 1);
+                }
+            }
+        });
+
+        ConcurrentPool<Message> concurrent;
+        auto const cache_ms = measure_ms([&] {
+            ConcurrentPool<Message>::Cache cache(concurrent);
+            for (int r = 0; r < ROUNDS; ++r) {
+                for (auto &m : live) {
+                    m = cache.allocate();
+                    m->seq = static_cast<datapod::u64>(r);
+                }
+                for (auto *m : live) {
+                    cache.deallocate(m);
+                }
+            }
+        });
+
+        auto const pairs = static_cast<double>(ROUNDS) * BATCH;
+        std::cout << "   malloc/free:             " << malloc_ms * 1e6 / pairs << "\n";
+        std::cout << "   Pool:                    " << pool_ms * 1e6 / pairs << "\n";
+        std::cout << "   ConcurrentPool::Cache:   " << cache_ms * 1e6 / pairs << "\n";
+    }
+
+    // 2. Driver allocates, workers free: the cross-thread recycling the pools are compared on
+    {
+        constexpr datapod::u64 N = 1000000;
+        std::cout << "\n2. Driver allocates, workers free (Mops/s):\n";
+        std::cout << "   workers   malloc    mutex+Pool   ConcurrentPool\n";
+        for (int workers : {1, 2, 4, 8}) {
+            auto const malloc_mops = pipeline(
+                workers, N, [] { return [] { return static_cast<Message *>(std::malloc(sizeof(Message))); }; },
+                [] { return [](Message *m) { std::free(m); }; });
+
+            LockedPool locked;
+            auto const locked_mops = pipeline(
+                workers, N, [&] { return [&] { return locked.allocate(); }; },
+                [&] { return [&](Message *m) { locked.deallocate(m); }; });
+
+            ConcurrentPool<Message> concurrent;
+            auto const concurrent_mops = pipeline(
+                workers, N,
+                [&] {
+                    return [cache = std::make_shared<ConcurrentPool<Message>::Cache>(concurrent)] {
+                        return cache->allocate();
+                    };
+                },
+                [&] {
+                    return [cache = std::make_shared<ConcurrentPool<Message>::Cache>(concurrent)](Message *m) {
+                        cache->deallocate(m);
+                    };
+                });
+
+            std::cout << "   " << workers << "\t     " << malloc_mops << "\t" << locked_mops << "\t   "
+                      << concurrent_mops << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <datapod/pods/lockfree/ring_buffer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Mutex-guarded deque as the baseline every lock-free queue has to beat
+struct LockedQueue {
+    explicit LockedQueue(size_t capacity) : capacity_{capacity} {}
+
+    bool push(uint64_t v) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (items_.size() >= capacity_) {
+            return false;
+        }
+        items_.push_back(v);
+        return true;
+    }
+
+    bool pop(uint64_t &v) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (items_.empty()) {
+            return false;
+        }
+        v = items_.front();
+        items_.pop_front();
+        return true;
+    }
+
+    size_t capacity_;
+    std::mutex mutex_;
+    std::deque<uint64_t> items_;
+};
+
+// Run `threads` producers and as many consumers moving `total` items, returns Mops/s
+template <typename Push, typename Pop> double run(int threads, uint64_t total, Push &&push, Pop &&pop) {
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> checksum{0};
+    auto const per_producer = total / static_cast<uint64_t>(threads);
+
+    auto const ms = measure_ms([&] {
+        std::vector<std::thread> workers;
+        for (int p = 0; p < threads; ++p) {
+            workers.emplace_back([&, p] {
+                for (uint64_t i = 0; i < per_producer; ++i) {
+                    while (!push(static_cast<uint64_t>(p) * per_producer + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < threads; ++c) {
+            workers.emplace_back([&] {
+                uint64_t sum = 0;
+                uint64_t v = 0;
+                while (popped.load(std::memory_order_relaxed) < per_producer * threads) {
+                    if (pop(v)) {
+                        sum += v;
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                checksum.fetch_add(sum);
+            });
+        }
+        for (auto &t : workers) {
+            t.join();
+        }
+    });
+
+    auto const n = per_producer * threads;
+    if (checksum.load() != n * (n - 1) / 2) {
+        std::cout << "   checksum mismatch!\n";
+    }
+    return static_cast<double>(n) / (ms * 1e3);
+}
+
+int main() {
+    std::cout << "=== MPMC Ring Buffer Contention Benchmark ===\n";
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    constexpr size_t CAPACITY = 1024;
+    constexpr uint64_t TOTAL = 2000000;
+
+    std::cout << "producers=consumers   RingBuffer<MPMC> Mops/s   mutex+deque Mops/s\n";
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+        RingBuffer<MPMC, uint64_t> ring(CAPACITY);
+        auto const ring_mops = run(
+            threads, TOTAL, [&](uint64_t v) { return ring.push(v).is_ok(); },
+            [&](uint64_t &v) {
+                auto r = ring.pop();
+                if (!r.is_ok()) {
+                    return false;
+                }
+                v = r.value();
+                return true;
+            });
+
+        LockedQueue locked(CAPACITY);
+        auto const locked_mops =
+            run(threads, TOTAL, [&](uint64_t v) { return locked.push(v); }, [&](uint64_t &v) { return locked.pop(v); });
+
+        std::cout << "   " << threads << "\t\t\t" << ring_mops << "\t\t\t" << locked_mops << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <datapod/pods/lockfree/ring_buffer.hpp>
+
+#include <chrono>
+#include <iostream>
+
+using namespace datapod;
+
+// Simple benchmark helper
+template <typename Func> double measure_ms(Func &&func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away
+static volatile size_t sink;
+
+// Hides the ring from the optimizer so every poll reloads the positions
+template <typename Ring> Ring &opaque(Ring &ring) {
+    Ring *volatile ptr = &ring;
+    return *ptr;
+}
+
+// Cost of one poll on an empty ring: pop() builds an Error, try_pop() does not
+template <typename Policy> void bench_empty_poll(const char *name) {
+    constexpr int ROUNDS = 10000000;
+    RingBuffer<Policy, uint64_t> ring(1024);
+
+    auto const pop_ms = measure_ms([&] {
+        size_t misses = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            misses += opaque(ring).pop().is_err() ? 1 : 0;
+        }
+        sink = misses;
+    });
+    auto const try_pop_ms = measure_ms([&] {
+        size_t misses = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            misses += opaque(ring).try_pop().has_value() ? 0 : 1;
+        }
+        sink = misses;
+    });
+
+    std::cout << "   " << name << ": pop() " << pop_ms * 1e6 / ROUNDS << " ns, try_pop() " << try_pop_ms * 1e6 / ROUNDS
+              << " ns per empty poll\n";
+}
+
+// Cost of one push attempt on a full ring
+template <typename Policy> void bench_full_push(const char *name) {
+    constexpr int ROUNDS = 10000000;
+    RingBuffer<Policy, uint64_t> ring(1024);
+    while (ring.try_push(0)) {
+    }
+
+    auto const push_ms = measure_ms([&] {
+        size_t misses = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            misses += opaque(ring).push(static_cast<uint64_t>(i)).is_err() ? 1 : 0;
+        }
+        sink = misses;
+    });
+    auto const try_push_ms = measure_ms([&] {
+        size_t misses = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            misses += opaque(ring).try_push(static_cast<uint64_t>(i)) ? 0 : 1;
+        }
+        sink = misses;
+    });
+
+    std::cout << "   " << name << ": push() " << push_ms * 1e6 / ROUNDS << " ns, try_push() "
+              << try_push_ms * 1e6 / ROUNDS << " ns per rejected push\n";
+}
+
+int main() {
+    std::cout << "=== Ring Buffer Poll Benchmark ===\n\n";
+
+    std::cout << "1. Polling an empty ring:\n";
+    bench_empty_poll<SPSC>("SPSC");
+    bench_empty_poll<SPMC>("SPMC");
+    bench_empty_poll<MPMC>("MPMC");
+
+    std::cout << "\n2. Pushing into a full ring:\n";
+    bench_full_push<SPSC>("SPSC");
+    bench_full_push<SPMC>("SPMC");
+    bench_full_push<MPMC>("MPMC");
+
+    return 0;
+}
@@ -9,6 +9,7 @@
  */
 
 #include "pods/associative/fws_multimap.hpp"
+#include "pods/associative/frozen_map.hpp"
 #include "pods/associative/map.hpp"
 #include "pods/associative/mutable_fws_multimap.hpp"
 #include "pods/associative/set.hpp"
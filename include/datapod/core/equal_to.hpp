@@ -2,6 +2,7 @@
 #include <datapod/types/types.hpp>
 
 #include <algorithm>
+#include <string_view>
 #include <type_traits>
 
 #include "datapod/core/decay.hpp"
@@ -49,7 +50,13 @@ namespace datapod {
 
             // IMPORTANT: Check operator== FIRST before to_tuple!
             // Otherwise primitive types like int will use to_tuple and compare incorrectly
-            if constexpr (is_eq_comparable_v<Type, Type1>) {
+            if constexpr ((std::is_class_v<Type> || std::is_class_v<Type1>) &&
+                          std::is_convertible_v<T const &, std::string_view> &&
+                          std::is_convertible_v<T1 const &, std::string_view>) {
+                // String-like on both sides (String, std::string, string_view, literals): compare the characters
+                // instead of converting one side into a temporary of the other's type
+                return std::string_view{a} == std::string_view{b};
+            } else if constexpr (is_eq_comparable_v<Type, Type1>) {
                 // Has operator== - use it (cast to common type to avoid sign comparison warnings)
                 using CommonType = std::common_type_t<Type, Type1>;
                 return static_cast<CommonType>(a) == static_cast<CommonType>(b);
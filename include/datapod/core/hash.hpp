@@ -1,9 +1,12 @@
 #pragma once
 #include <datapod/types/types.hpp>
 
+#include <bit>
 #include <cinttypes>
 #include <cstddef>
+#include <cstring>
 #include <string_view>
+#include <type_traits>
 
 namespace datapod {
 
@@ -42,4 +45,169 @@ namespace datapod {
         return buf.size() == 0U ? h : hash(std::string_view{reinterpret_cast<char const *>(&buf[0U]), buf.size()}, h);
     }
 
+    // =============================================================================
+    // Bulk hash (XXH64)
+    // =============================================================================
+    //
+    // FNV-1a above consumes one byte per multiply and stays the hash for type hashes and other
+    // compile-time names. Runtime buffers (integrity checksums, string keys) use XXH64, which
+    // consumes 32-byte stripes in four independent lanes. BulkHasher is incremental and gives the
+    // same result however the input is split, so streaming targets can checksum chunk by chunk.
+
+    constexpr auto const BULK_HASH_SEED = 0ULL;
+
+    namespace detail {
+        constexpr datapod::u64 XXH_PRIME_1 = 0x9E3779B185EBCA87ULL;
+        constexpr datapod::u64 XXH_PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr datapod::u64 XXH_PRIME_3 = 0x165667B19E3779F9ULL;
+        constexpr datapod::u64 XXH_PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr datapod::u64 XXH_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+        // Little-endian loads; a plain memcpy at runtime, byte assembly during constant evaluation
+        template <typename UInt> constexpr UInt read_le(char const *p) noexcept {
+            if (std::is_constant_evaluated() || std::endian::native != std::endian::little) {
+                auto v = UInt{};
+                for (datapod::usize i = 0U; i != sizeof(UInt); ++i) {
+                    v |= static_cast<UInt>(static_cast<datapod::u8>(p[i])) << (8U * i);
+                }
+                return v;
+            } else {
+                UInt v;
+                std::memcpy(&v, p, sizeof(UInt));
+                return v;
+            }
+        }
+
+        constexpr datapod::u64 xxh_round(datapod::u64 acc, datapod::u64 const input) noexcept {
+            acc += input * XXH_PRIME_2;
+            acc = std::rotl(acc, 31);
+            return acc * XXH_PRIME_1;
+        }
+
+        constexpr datapod::u64 xxh_merge(datapod::u64 acc, datapod::u64 const val) noexcept {
+            acc ^= xxh_round(0U, val);
+            return acc * XXH_PRIME_1 + XXH_PRIME_4;
+        }
+    } // namespace detail
+
+    // Incremental XXH64
+    struct BulkHasher {
+        static constexpr datapod::usize STRIPE = 32U;
+
+        constexpr explicit BulkHasher(hash_t const seed = BULK_HASH_SEED) noexcept
+            : lanes_{seed + detail::XXH_PRIME_1 + detail::XXH_PRIME_2, seed + detail::XXH_PRIME_2, seed,
+                     seed - detail::XXH_PRIME_1},
+              seed_{seed} {}
+
+        constexpr void update(char const *p, datapod::usize n) noexcept {
+            total_ += n;
+
+            // Top up a partial stripe first
+            if (buffered_ != 0U) {
+                auto const take = n < STRIPE - buffered_ ? n : STRIPE - buffered_;
+                for (datapod::usize i = 0U; i != take; ++i) {
+                    buf_[buffered_ + i] = p[i];
+                }
+                buffered_ += take;
+                p += take;
+                n -= take;
+                if (buffered_ != STRIPE) {
+                    return;
+                }
+                consume(buf_);
+                buffered_ = 0U;
+            }
+
+            for (; n >= STRIPE; p += STRIPE, n -= STRIPE) {
+                consume(p);
+            }
+
+            for (datapod::usize i = 0U; i != n; ++i) {
+                buf_[i] = p[i];
+            }
+            buffered_ = n;
+        }
+
+        void update(void const *p, datapod::usize const n) noexcept { update(static_cast<char const *>(p), n); }
+
+        constexpr void update(std::string_view const s) noexcept { update(s.data(), s.size()); }
+
+        constexpr hash_t digest() const noexcept {
+            auto const h = total_ >= STRIPE ? converge(lanes_) : seed_ + detail::XXH_PRIME_5;
+            return finalize(h + total_, buf_, buffered_);
+        }
+
+        // Fold the four stripe lanes into one accumulator
+        static constexpr datapod::u64 converge(datapod::u64 const (&lanes)[4]) noexcept {
+            auto h = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+            for (auto const lane : lanes) {
+                h = detail::xxh_merge(h, lane);
+            }
+            return h;
+        }
+
+        // Mix in the trailing (< STRIPE) bytes and avalanche
+        static constexpr hash_t finalize(datapod::u64 h, char const *p, datapod::usize n) noexcept {
+            using namespace detail;
+
+            for (; n >= 8U; p += 8, n -= 8U) {
+                h ^= xxh_round(0U, read_le<datapod::u64>(p));
+                h = std::rotl(h, 27) * XXH_PRIME_1 + XXH_PRIME_4;
+            }
+            if (n >= 4U) {
+                h ^= static_cast<datapod::u64>(read_le<datapod::u32>(p)) * XXH_PRIME_1;
+                h = std::rotl(h, 23) * XXH_PRIME_2 + XXH_PRIME_3;
+                p += 4;
+                n -= 4U;
+            }
+            for (; n != 0U; ++p, --n) {
+                h ^= static_cast<datapod::u8>(*p) * XXH_PRIME_5;
+                h = std::rotl(h, 11) * XXH_PRIME_1;
+            }
+
+            h ^= h >> 33U;
+            h *= XXH_PRIME_2;
+            h ^= h >> 29U;
+            h *= XXH_PRIME_3;
+            h ^= h >> 32U;
+            return h;
+        }
+
+      private:
+        constexpr void consume(char const *p) noexcept {
+            for (datapod::usize i = 0U; i != 4U; ++i) {
+                lanes_[i] = detail::xxh_round(lanes_[i], detail::read_le<datapod::u64>(p + 8U * i));
+            }
+        }
+
+        datapod::u64 lanes_[4];
+        char buf_[STRIPE]{};
+        datapod::usize buffered_{0U};
+        datapod::u64 total_{0U};
+        hash_t seed_;
+    };
+
+    // One-shot XXH64 of a byte range (reads the input in place, no stripe buffering)
+    constexpr hash_t hash_bulk(std::string_view const s, hash_t const seed = BULK_HASH_SEED) noexcept {
+        using namespace detail;
+
+        auto const *p = s.data();
+        auto n = s.size();
+        auto h = seed + XXH_PRIME_5;
+        if (n >= BulkHasher::STRIPE) {
+            datapod::u64 lanes[4] = {seed + XXH_PRIME_1 + XXH_PRIME_2, seed + XXH_PRIME_2, seed, seed - XXH_PRIME_1};
+            for (; n >= BulkHasher::STRIPE; p += BulkHasher::STRIPE, n -= BulkHasher::STRIPE) {
+                for (datapod::usize i = 0U; i != 4U; ++i) {
+                    lanes[i] = xxh_round(lanes[i], read_le<datapod::u64>(p + 8U * i));
+                }
+            }
+            h = BulkHasher::converge(lanes);
+        }
+        return BulkHasher::finalize(h + s.size(), p, n);
+    }
+
+    inline hash_t hash_bulk(void const *data, datapod::usize const n, hash_t const seed = BULK_HASH_SEED) noexcept {
+        return hash_bulk(std::string_view{static_cast<char const *>(data), n}, seed);
+    }
+
 } // namespace datapod
@@ -16,6 +16,8 @@ namespace datapod {
         WITH_STATIC_VERSION = 1U << 6U,  // Use static (constexpr) version hash
         SKIP_INTEGRITY = 1U << 7U,       // Skip integrity check on deserialize
         SKIP_VERSION = 1U << 8U,         // Skip version check on deserialize
+        FNV_INTEGRITY = 1U << 9U,        // Integrity checksum with byte-wise FNV-1a (pre-XXH64 buffers)
+        COMPACT = 1U << 10U,             // Varint integers and lengths, no alignment padding
         _CONST = 1U << 29U,              // Internal: const data marker
         _PHASE_II = 1U << 30U            // Internal: second serialization phase
     };
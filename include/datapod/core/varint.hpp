@@ -0,0 +1,73 @@
+#pragma once
+#include <datapod/types/types.hpp>
+
+#include <type_traits>
+
+namespace datapod {
+
+    // ============================================================================
+    // LEB128 Varints
+    // ============================================================================
+
+    // Seven payload bits per byte, least significant group first, high bit set on all but the
+    // last byte. Values below 128 take one byte; a full u64 takes VARINT_MAX_BYTES.
+    constexpr datapod::usize VARINT_MAX_BYTES = 10U;
+
+    // Encode v into out (at least VARINT_MAX_BYTES long), returns the number of bytes written
+    constexpr datapod::usize varint_encode(datapod::u64 v, datapod::u8 *out) noexcept {
+        datapod::usize n = 0U;
+        while (v >= 0x80U) {
+            out[n++] = static_cast<datapod::u8>(v | 0x80U);
+            v >>= 7U;
+        }
+        out[n++] = static_cast<datapod::u8>(v);
+        return n;
+    }
+
+    // Encoded length of v
+    constexpr datapod::usize varint_size(datapod::u64 v) noexcept {
+        datapod::usize n = 1U;
+        for (; v >= 0x80U; v >>= 7U) {
+            ++n;
+        }
+        return n;
+    }
+
+    // Decode one varint from [p, end) into v, returns the bytes consumed or 0 when the input is
+    // truncated, overflows 64 bits or is not the shortest encoding (a zero final byte after the
+    // first, e.g. 0x80 0x00 for 0), so each value has exactly one accepted encoding
+    constexpr datapod::usize varint_decode(datapod::u8 const *p, datapod::u8 const *end, datapod::u64 &v) noexcept {
+        datapod::u64 result = 0U;
+        for (datapod::usize i = 0U; i != VARINT_MAX_BYTES && p + i != end; ++i) {
+            auto const byte = static_cast<datapod::u64>(p[i]);
+            if (i == VARINT_MAX_BYTES - 1U && byte > 1U) {
+                return 0U; // Bits past 64
+            }
+            result |= (byte & 0x7FU) << (7U * i);
+            if ((byte & 0x80U) == 0U) {
+                if (byte == 0U && i != 0U) {
+                    return 0U; // Overlong
+                }
+                v = result;
+                return i + 1U;
+            }
+        }
+        return 0U;
+    }
+
+    // ============================================================================
+    // ZigZag
+    // ============================================================================
+
+    // Interleave signed values so small magnitudes stay small: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+    template <typename T> constexpr std::make_unsigned_t<T> zigzag_encode(T const v) noexcept {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>((static_cast<U>(v) << 1U) ^ static_cast<U>(v < 0 ? ~U{0} : U{0}));
+    }
+
+    template <typename T> constexpr T zigzag_decode(std::make_unsigned_t<T> const v) noexcept {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<U>(v >> 1U) ^ static_cast<U>(U{0} - static_cast<U>(v & 1U)));
+    }
+
+} // namespace datapod
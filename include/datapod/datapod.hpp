@@ -39,6 +39,7 @@
 #include "core/equal_to.hpp"
 #include "core/next_power_of_2.hpp"
 #include "core/strong.hpp"
+#include "core/varint.hpp"
 
 // Memory management (PODs)
 #include "pods/memory/allocator.hpp"
@@ -61,9 +62,14 @@
 
 // Serialization system
 #include "serialization/buf.hpp"
+#include "serialization/checksum.hpp"
+#include "serialization/delta.hpp"
 #include "serialization/match.hpp"
+#include "serialization/parallel.hpp"
 #include "serialization/serialize.hpp"
 #include "serialization/serialized_size.hpp"
+#include "serialization/stream.hpp"
+#include "serialization/view.hpp"
 
 // All category headers (everything!)
 #include "adapters.hpp"
@@ -83,9 +83,19 @@ namespace datapod {
     };
 
     // Hasher for BasicString
+    // Transparent: anything convertible to std::string_view hashes like the String holding the same
+    // characters, so Map<String, V> lookups by string_view or literal build no temporary String
     template <typename Ptr> struct Hasher<BasicString<Ptr>> {
+        using is_transparent = void;
+
         constexpr hash_t operator()(BasicString<Ptr> const &str, hash_t h = BASE_HASH) const noexcept {
-            return hash(std::string_view{str.data(), str.size()}, h);
+            return hash_bulk(std::string_view{str.data(), str.size()}, h);
+        }
+
+        template <typename S>
+        requires(std::is_convertible_v<S const &, std::string_view> && !std::is_same_v<S, BasicString<Ptr>>)
+        constexpr hash_t operator()(S const &str, hash_t h = BASE_HASH) const noexcept {
+            return hash_bulk(std::string_view{str}, h);
         }
     };
 
@@ -145,19 +155,21 @@ namespace datapod {
     // Hasher for std::string_view (commonly used)
     template <> struct Hasher<std::string_view> {
         constexpr hash_t operator()(std::string_view const &sv, hash_t h = BASE_HASH) const noexcept {
-            return hash(sv, h);
+            return hash_bulk(sv, h);
         }
     };
 
     // Hasher for C-style strings
     template <datapod::usize N> struct Hasher<char[N]> {
-        constexpr hash_t operator()(char const (&str)[N], hash_t h = BASE_HASH) const noexcept { return hash(str, h); }
+        constexpr hash_t operator()(char const (&str)[N], hash_t h = BASE_HASH) const noexcept {
+            return hash_bulk(std::string_view{str, N - 1U}, h);
+        }
     };
 
     // Hasher for const char*
     template <> struct Hasher<char const *> {
         constexpr hash_t operator()(char const *str, hash_t h = BASE_HASH) const noexcept {
-            return hash(std::string_view{str}, h);
+            return hash_bulk(std::string_view{str}, h);
         }
     };
 
@@ -0,0 +1,247 @@
+#pragma once
+#include <datapod/types/types.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "datapod/core/equal_to.hpp"
+#include "datapod/core/exception.hpp"
+#include "datapod/hashing.hpp"
+#include "datapod/pods/adapters/optional.hpp"
+#include "datapod/pods/adapters/pair.hpp"
+#include "datapod/pods/associative/hash_storage.hpp"
+#include "datapod/pods/sequential/vector.hpp"
+
+namespace datapod {
+
+    // Read-only map over a minimal perfect hash (PTHash-style "hash and displace")
+    //
+    // For tables built once and then only read (model properties, joint names, sensor catalogs).
+    // The n entries sit in an array of exactly n slots, with no control bytes and no empty slots.
+    // Keys are split into buckets of about three, and each bucket stores a 32-bit pilot. The builder
+    // picks the pilot so that every key of the bucket lands in a slot no other key has. A lookup
+    // hashes the key, reads the bucket's pilot, computes the slot and compares that one entry.
+    // Absent keys fail the comparison. The table is about half the size of a Map, but the entry load
+    // waits for the pilot load, so out-of-cache lookups are not faster. Building takes O(n) memory and
+    // about 0.5 s per million keys.
+    //
+    // The layout is plain data (a seed and two vectors), so FrozenMap goes through serialize()
+    // like any struct, and offset::FrozenMap through serialize_view()/view() for zero-copy mmap.
+    //
+    //   auto frozen = frozen_map::make(map);             // or FrozenMap<K, V>::build(entries)
+    //   if (auto const *e = frozen.find(key)) { use(e->second); }
+    template <typename Key, typename Value, template <typename> typename Vec, typename Hash = Hasher<Key>,
+              typename Eq = EqualTo<Key>>
+    struct BasicFrozenMap {
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = Pair<Key, Value>;
+        using size_type = datapod::usize;
+        using const_iterator = value_type const *;
+        using iterator = const_iterator;
+
+        static constexpr datapod::u64 DEFAULT_SEED = 0x9E3779B97F4A7C15ULL;
+        static constexpr datapod::usize KEYS_PER_BUCKET = 3U;
+
+        // Build from any range of pairs (.first / .second), e.g. a Map; keys must be unique
+        template <typename Range> static BasicFrozenMap build(Range const &range, datapod::u64 seed = DEFAULT_SEED) {
+            std::vector<decltype(&*std::begin(range))> source;
+            for (auto const &entry : range) {
+                source.push_back(&entry);
+            }
+            if (source.size() > std::numeric_limits<datapod::u32>::max()) {
+                throw_exception(std::length_error{"FrozenMap: more than 2^32 - 1 entries"});
+            }
+
+            BasicFrozenMap m;
+            m.seed_ = seed;
+            auto const n = static_cast<datapod::u32>(source.size());
+            if (n == 0U) {
+                return m;
+            }
+            auto const buckets = static_cast<datapod::u32>((n + KEYS_PER_BUCKET - 1U) / KEYS_PER_BUCKET);
+
+            // Keys grouped by bucket (counting sort), then buckets from largest to smallest: the big ones
+            // are hardest to place and go first, while most slots are still free
+            std::vector<datapod::u64> hashes(n);
+            std::vector<datapod::u32> bucket_start(buckets + 1U, 0U);
+            for (datapod::u32 i = 0; i != n; ++i) {
+                hashes[i] = m.hash_of(source[i]->first);
+                ++bucket_start[bucket_of(hashes[i], buckets) + 1U];
+            }
+            for (datapod::u32 b = 0; b != buckets; ++b) {
+                bucket_start[b + 1U] += bucket_start[b];
+            }
+            std::vector<datapod::u32> keys_by_bucket(n);
+            {
+                auto fill = bucket_start;
+                for (datapod::u32 i = 0; i != n; ++i) {
+                    keys_by_bucket[fill[bucket_of(hashes[i], buckets)]++] = i;
+                }
+            }
+            std::vector<datapod::u32> order(buckets);
+            for (datapod::u32 b = 0; b != buckets; ++b) {
+                order[b] = b;
+            }
+            std::stable_sort(order.begin(), order.end(), [&](datapod::u32 a, datapod::u32 b) {
+                return bucket_start[a + 1U] - bucket_start[a] > bucket_start[b + 1U] - bucket_start[b];
+            });
+
+            std::vector<datapod::u32> pilots(buckets, 0U);
+            std::vector<datapod::u32> slot_source(n, n); // n: free
+            std::vector<datapod::u32> slots;
+            for (auto const b : order) {
+                auto const first = bucket_start[b];
+                auto const last = bucket_start[b + 1U];
+                if (first == last) {
+                    break; // Only empty buckets remain
+                }
+                for (auto i = first; i != last; ++i) {
+                    for (auto j = first; j != i; ++j) {
+                        if (hashes[keys_by_bucket[i]] == hashes[keys_by_bucket[j]]) {
+                            // No pilot can separate two keys with the same 64-bit hash
+                            throw_exception(std::invalid_argument{source[keys_by_bucket[i]]->first ==
+                                                                          source[keys_by_bucket[j]]->first
+                                                                      ? "FrozenMap: duplicate key"
+                                                                      : "FrozenMap: two keys with the same hash"});
+                        }
+                    }
+                }
+
+                for (datapod::u64 pilot = 0;; ++pilot) {
+                    if (pilot > std::numeric_limits<datapod::u32>::max()) {
+                        throw_exception(std::runtime_error{"FrozenMap: no pilot places the bucket"});
+                    }
+                    slots.clear();
+                    auto fits = true;
+                    for (auto i = first; i != last && fits; ++i) {
+                        auto const s = slot_of(hashes[keys_by_bucket[i]], static_cast<datapod::u32>(pilot), n);
+                        fits = slot_source[s] == n && std::find(slots.begin(), slots.end(), s) == slots.end();
+                        slots.push_back(s);
+                    }
+                    if (fits) {
+                        for (auto i = first; i != last; ++i) {
+                            slot_source[slots[i - first]] = keys_by_bucket[i];
+                        }
+                        pilots[b] = static_cast<datapod::u32>(pilot);
+                        break;
+                    }
+                }
+            }
+
+            m.pilots_.reserve(buckets);
+            for (auto const p : pilots) {
+                m.pilots_.push_back(p);
+            }
+            m.entries_.reserve(n);
+            for (auto const i : slot_source) {
+                m.entries_.push_back(value_type{convert<Key>(source[i]->first), convert<Value>(source[i]->second)});
+            }
+            return m;
+        }
+
+        // Lookup: one pilot read and one entry comparison; any key type Hash and Eq accept
+        template <typename K> const_iterator find(K const &key) const {
+            if (entries_.empty()) {
+                return end();
+            }
+            auto const h = hash_of(key);
+            auto const n = static_cast<datapod::u32>(entries_.size());
+            auto const buckets = static_cast<datapod::u32>(pilots_.size());
+            auto const *entry = entries_.data() + slot_of(h, pilots_[bucket_of(h, buckets)], n);
+            return Eq{}(entry->first, key) ? entry : end();
+        }
+
+        template <typename K> bool contains(K const &key) const { return find(key) != end(); }
+        template <typename K> size_type count(K const &key) const { return contains(key) ? 1U : 0U; }
+
+        template <typename K> Optional<Value> get(K const &key) const {
+            auto const it = find(key);
+            return it != end() ? Optional<Value>(it->second) : Optional<Value>();
+        }
+
+        template <typename K> Value const &at(K const &key) const {
+            auto const it = find(key);
+            if (it == end()) {
+                throw_exception(std::out_of_range{"FrozenMap::at() key not found"});
+            }
+            return it->second;
+        }
+
+        // Entries in slot order
+        const_iterator begin() const noexcept { return entries_.data(); }
+        const_iterator end() const noexcept { return entries_.data() + entries_.size(); }
+
+        size_type size() const noexcept { return entries_.size(); }
+        bool empty() const noexcept { return entries_.empty(); }
+
+        // Serialization support
+        auto members() noexcept { return std::tie(seed_, pilots_, entries_); }
+
+        template <typename K> datapod::u64 hash_of(K const &key) const {
+            return mix(static_cast<datapod::u64>(Hash{}(key)) ^ seed_);
+        }
+
+        // murmur3 finalizer: spreads every input bit over the whole word
+        static constexpr datapod::u64 mix(datapod::u64 x) noexcept {
+            x ^= x >> 33U;
+            x *= 0xFF51AFD7ED558CCDULL;
+            x ^= x >> 33U;
+            x *= 0xC4CEB9FE1A85EC53ULL;
+            x ^= x >> 33U;
+            return x;
+        }
+
+        // Both scale 32 bits onto [0, n) with a multiply instead of a division. The slot re-mixes the hash with
+        // the pilot: a plain h ^ f(pilot) would keep the top-bit difference of two keys for every pilot
+        static constexpr datapod::u32 bucket_of(datapod::u64 const h, datapod::u32 const buckets) noexcept {
+            return static_cast<datapod::u32>(((h & 0xFFFFFFFFULL) * buckets) >> 32U);
+        }
+
+        static constexpr datapod::u32 slot_of(datapod::u64 const h, datapod::u32 const pilot,
+                                              datapod::u32 const n) noexcept {
+            return static_cast<datapod::u32>(((mix(h ^ (pilot * DEFAULT_SEED)) >> 32U) * n) >> 32U);
+        }
+
+        // Copies a key or value from the source map; string types go through std::string_view, since
+        // String -> offset::String is otherwise ambiguous (via std::string or via std::string_view)
+        template <typename To, typename From> static To convert(From const &from) {
+            if constexpr (!std::is_same_v<To, From> && std::is_convertible_v<From const &, std::string_view> &&
+                          std::is_constructible_v<To, std::string_view>) {
+                return To(std::string_view{from});
+            } else {
+                return To(from);
+            }
+        }
+
+        datapod::u64 seed_{DEFAULT_SEED};
+        Vec<datapod::u32> pilots_;
+        Vec<value_type> entries_;
+    };
+
+    // FrozenMap using raw pointers (default)
+    template <typename Key, typename Value, typename Hash = Hasher<Key>, typename Eq = EqualTo<Key>>
+    using FrozenMap = BasicFrozenMap<Key, Value, Vector, Hash, Eq>;
+
+    // FrozenMap using offset pointers (for zero-copy views)
+    namespace offset {
+        template <typename Key, typename Value, typename Hash = Hasher<Key>, typename Eq = EqualTo<Key>>
+        using FrozenMap = BasicFrozenMap<Key, Value, offset::Vector, Hash, Eq>;
+    } // namespace offset
+
+    namespace frozen_map {
+        /// Freeze a Map into a FrozenMap with the same key, value, Hash and Eq
+        template <typename T, template <typename> typename Ptr, typename GetKey, typename GetValue, typename Hash,
+                  typename Eq>
+        auto make(HashStorage<T, Ptr, GetKey, GetValue, Hash, Eq> const &map) {
+            using Storage = HashStorage<T, Ptr, GetKey, GetValue, Hash, Eq>;
+            return FrozenMap<typename Storage::key_type, typename Storage::mapped_type, Hash, Eq>::build(map);
+        }
+    } // namespace frozen_map
+
+} // namespace datapod
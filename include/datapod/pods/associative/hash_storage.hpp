@@ -1,11 +1,13 @@
 #pragma once
 #include <datapod/types/types.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -18,6 +20,21 @@
 #include "datapod/pods/adapters/optional.hpp"
 #include "datapod/pods/memory/ptr.hpp"
 
+// Control-group implementation, picked at compile time: 16 slots per probe with SSE2 on x86 and with
+// NEON on little-endian ARM, 8 slots with portable SWAR arithmetic elsewhere or when
+// DATAPOD_HASH_NO_SIMD is defined. The width decides where entries land, so serialize_view() images of
+// offset tables only load in builds with the same HashStorage::WIDTH (their version hash includes it).
+// The serialize() format stores entries only and does not depend on the width.
+#if !defined(DATAPOD_HASH_NO_SIMD) &&                                                                                  \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DATAPOD_HASH_SSE2
+#include <emmintrin.h>
+#elif !defined(DATAPOD_HASH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) &&                              \
+    defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define DATAPOD_HASH_NEON
+#include <arm_neon.h>
+#endif
+
 namespace datapod {
 
     // Generic hash-based container (Swiss table implementation)
@@ -35,13 +52,32 @@ namespace datapod {
         using size_type = hash_t;
         using key_type = decay_t<decltype(std::declval<GetKey>().operator()(std::declval<T>()))>;
         using mapped_type = decay_t<decltype(std::declval<GetValue>().operator()(std::declval<T>()))>;
-        using group_t = datapod::u64;
         using h2_t = datapod::u8;
+#if defined(DATAPOD_HASH_SSE2)
+        using group_t = __m128i;
+        using mask_t = datapod::u32; // One bit per slot (_mm_movemask_epi8)
+        static constexpr size_type const WIDTH = 16U;
+        static constexpr unsigned const MASK_SHIFT = 0U;
+#elif defined(DATAPOD_HASH_NEON)
+        using group_t = uint8x16_t;
+        using mask_t = datapod::u64; // One nibble per slot (NEON has no movemask)
+        static constexpr size_type const WIDTH = 16U;
+        static constexpr unsigned const MASK_SHIFT = 2U;
+#else
+        using group_t = datapod::u64;
+        using mask_t = datapod::u64; // One byte per slot
         static constexpr size_type const WIDTH = 8U;
+        static constexpr unsigned const MASK_SHIFT = 3U;
+#endif
         static constexpr datapod::usize const ALIGNMENT = alignof(T);
 
         template <typename Key> hash_t compute_hash(Key const &k) const { return static_cast<size_type>(Hash{}(k)); }
 
+        // Hash of a key as the table computes it. Pass it to the (key, hash) overloads of find(), contains(),
+        // erase() and to emplace_hint_hash() to hash a key once for several operations, or for several tables
+        // with the same Hash. Any key type the Hash accepts works (e.g. std::string_view for String keys).
+        template <typename Key> size_type hash_of(Key const &key) const { return compute_hash(key); }
+
         enum ctrl_t : int8_t { EMPTY = -128, DELETED = -2, END = -1 };
 
         struct find_info {
@@ -60,10 +96,11 @@ namespace datapod {
             size_type mask_, offset_, index_{0U};
         };
 
+        // Set of matching slots in a group, one bit (the highest of the slot's 1 << MASK_SHIFT bits) per slot
         struct bit_mask {
-            static constexpr auto const SHIFT = 3U;
+            static constexpr auto const SHIFT = MASK_SHIFT;
 
-            constexpr explicit bit_mask(group_t const mask) noexcept : mask_{mask} {}
+            constexpr explicit bit_mask(mask_t const mask) noexcept : mask_{mask} {}
 
             bit_mask &operator++() noexcept {
                 mask_ &= (mask_ - 1U);
@@ -80,16 +117,75 @@ namespace datapod {
             size_type trailing_zeros() const noexcept { return ::datapod::trailing_zeros(mask_) >> SHIFT; }
 
             size_type leading_zeros() const noexcept {
-                constexpr int total_significant_bits = 8 << SHIFT;
-                constexpr int extra_bits = sizeof(group_t) * 8 - total_significant_bits;
-                return ::datapod::leading_zeros(mask_ << extra_bits) >> SHIFT;
+                constexpr int total_significant_bits = WIDTH << SHIFT;
+                constexpr int extra_bits = sizeof(mask_t) * 8 - total_significant_bits;
+                return ::datapod::leading_zeros(static_cast<mask_t>(mask_ << extra_bits)) >> SHIFT;
             }
 
             friend bool operator!=(bit_mask const &a, bit_mask const &b) noexcept { return a.mask_ != b.mask_; }
 
-            group_t mask_;
+            mask_t mask_;
         };
 
+#if defined(DATAPOD_HASH_SSE2)
+        struct group {
+            explicit group(ctrl_t const *pos) noexcept
+                : ctrl_{_mm_loadu_si128(reinterpret_cast<__m128i const *>(pos))} {}
+
+            bit_mask match(h2_t const hash) const noexcept {
+                return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(hash)), ctrl_));
+            }
+
+            bit_mask match_empty() const noexcept { return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(EMPTY), ctrl_)); }
+
+            // EMPTY and DELETED are the only control bytes below END (signed compare)
+            bit_mask match_empty_or_deleted() const noexcept {
+                return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(END), ctrl_));
+            }
+
+            datapod::usize count_leading_empty_or_deleted() const noexcept {
+                return trailing_zeros(match_empty_or_deleted().mask_ + 1U);
+            }
+
+            static bit_mask to_mask(__m128i const bytes) noexcept {
+                return bit_mask{static_cast<mask_t>(_mm_movemask_epi8(bytes))};
+            }
+
+            group_t ctrl_;
+        };
+#elif defined(DATAPOD_HASH_NEON)
+        struct group {
+            static constexpr auto MSBS = 0x8888888888888888ULL;
+
+            explicit group(ctrl_t const *pos) noexcept : ctrl_{vld1q_u8(reinterpret_cast<datapod::u8 const *>(pos))} {}
+
+            bit_mask match(h2_t const hash) const noexcept {
+                return bit_mask{nibbles(vceqq_u8(ctrl_, vdupq_n_u8(hash))) & MSBS};
+            }
+
+            bit_mask match_empty() const noexcept {
+                return bit_mask{nibbles(vceqq_u8(ctrl_, vdupq_n_u8(static_cast<datapod::u8>(EMPTY)))) & MSBS};
+            }
+
+            // EMPTY and DELETED are the only control bytes below END (signed compare)
+            bit_mask match_empty_or_deleted() const noexcept { return bit_mask{empty_or_deleted() & MSBS}; }
+
+            datapod::usize count_leading_empty_or_deleted() const noexcept {
+                return trailing_zeros(~empty_or_deleted()) >> MASK_SHIFT;
+            }
+
+            mask_t empty_or_deleted() const noexcept {
+                return nibbles(vcltq_s8(vreinterpretq_s8_u8(ctrl_), vdupq_n_s8(END)));
+            }
+
+            // Narrows a 0x00/0xFF byte vector to 4 bits per byte in a u64
+            static mask_t nibbles(uint8x16_t const bytes) noexcept {
+                return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4)), 0);
+            }
+
+            group_t ctrl_;
+        };
+#else
         struct group {
             static constexpr auto MSBS = 0x8080808080808080ULL;
             static constexpr auto LSBS = 0x0101010101010101ULL;
@@ -112,6 +208,7 @@ namespace datapod {
 
             group_t ctrl_;
         };
+#endif
 
         struct iterator {
             using iterator_category = std::forward_iterator_tag;
@@ -186,10 +283,12 @@ namespace datapod {
             iterator inner_;
         };
 
+        // Control bytes of a table with no slots: END plus WIDTH (at most 16) bytes a group may read past it
         static ctrl_t *empty_group() noexcept {
             alignas(16) static constexpr ctrl_t empty_group_data[] = {END,   EMPTY, EMPTY, EMPTY, EMPTY, EMPTY,
                                                                       EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY,
-                                                                      EMPTY, EMPTY, EMPTY, EMPTY};
+                                                                      EMPTY, EMPTY, EMPTY, EMPTY, EMPTY};
+            static_assert(sizeof(empty_group_data) >= 1U + WIDTH);
             return const_cast<ctrl_t *>(empty_group_data);
         }
 
@@ -265,9 +364,9 @@ namespace datapod {
         template <typename Key> mapped_type &bracket_operator_impl(Key &&key) {
             auto const res = find_or_prepare_insert(std::forward<Key>(key));
             if (res.second) {
-                new (entries_ + res.first) T{static_cast<key_type>(key), mapped_type{}};
+                new (entries() + res.first) T{static_cast<key_type>(key), mapped_type{}};
             }
-            return GetValue{}(entries_[res.first]);
+            return GetValue{}(entries()[res.first]);
         }
 
         template <typename Key> mapped_type &operator[](Key &&key) {
@@ -307,12 +406,13 @@ namespace datapod {
         }
 
         // find()
-        template <typename Key> iterator find_impl(Key &&key) {
-            auto const hash = compute_hash(key);
+        template <typename Key> iterator find_impl(Key &&key) { return find_impl(key, compute_hash(key)); }
+
+        template <typename Key> iterator find_impl(Key const &key, size_type const hash) {
             for (auto seq = probe_seq{h1(hash), capacity_}; true; seq.next()) {
-                group g{ctrl_ + seq.offset_};
+                group g{ctrl() + seq.offset_};
                 for (auto const i : g.match(h2(hash))) {
-                    if (Eq{}(GetKey()(entries_[seq.offset(i)]), key)) {
+                    if (Eq{}(GetKey()(entries()[seq.offset(i)]), key)) {
                         return iterator_at(seq.offset(i));
                     }
                 }
@@ -334,6 +434,79 @@ namespace datapod {
 
         iterator find(key_type const &key) noexcept { return find_impl(key); }
 
+        // find() with hash == hash_of(key)
+        template <typename Key> iterator find(Key const &key, size_type const hash) { return find_impl(key, hash); }
+
+        template <typename Key> const_iterator find(Key const &key, size_type const hash) const {
+            return const_cast<HashStorage *>(this)->find_impl(key, hash);
+        }
+
+        // find_batch() / contains_batch()
+        // Looks up keys[i] into out[i]. Keys go through in blocks: hash every key of the block and prefetch its
+        // control group, then prefetch the entries its first group matches, then resolve, so the cache misses
+        // of one block overlap instead of forming one dependent chain per key.
+        static constexpr datapod::usize const BATCH_BLOCK = 16U;
+
+        void find_batch(std::span<key_type const> keys, std::span<iterator> out) {
+            if (out.size() < keys.size()) {
+                throw_exception(std::length_error{"HashStorage::find_batch() output shorter than keys"});
+            }
+            for_each_batch(keys, [&](datapod::usize const i, iterator const it) { out[i] = it; });
+        }
+
+        void find_batch(std::span<key_type const> keys, std::span<const_iterator> out) const {
+            if (out.size() < keys.size()) {
+                throw_exception(std::length_error{"HashStorage::find_batch() output shorter than keys"});
+            }
+            const_cast<HashStorage *>(this)->for_each_batch(
+                keys, [&](datapod::usize const i, iterator const it) { out[i] = it; });
+        }
+
+        // Writes whether keys[i] is present into out[i], returns how many are
+        size_type contains_batch(std::span<key_type const> keys, std::span<bool> out) const {
+            if (out.size() < keys.size()) {
+                throw_exception(std::length_error{"HashStorage::contains_batch() output shorter than keys"});
+            }
+            size_type found = 0U;
+            auto *const self = const_cast<HashStorage *>(this);
+            auto const last = self->end();
+            self->for_each_batch(keys, [&](datapod::usize const i, iterator const it) {
+                out[i] = it != last;
+                found += out[i] ? 1U : 0U;
+            });
+            return found;
+        }
+
+        template <typename Fn> void for_each_batch(std::span<key_type const> keys, Fn &&fn) {
+            size_type hashes[BATCH_BLOCK];
+            for (datapod::usize first = 0U; first < keys.size(); first += BATCH_BLOCK) {
+                auto const n = std::min(BATCH_BLOCK, keys.size() - first);
+                for (datapod::usize j = 0U; j != n; ++j) {
+                    hashes[j] = compute_hash(keys[first + j]);
+                    prefetch(ctrl() + (h1(hashes[j]) & capacity_));
+                }
+                for (datapod::usize j = 0U; j != n; ++j) {
+                    auto const offset = h1(hashes[j]) & capacity_;
+                    for (auto const i : group{ctrl() + offset}.match(h2(hashes[j]))) {
+                        prefetch(entries() + ((offset + i) & capacity_));
+                    }
+                }
+                for (datapod::usize j = 0U; j != n; ++j) {
+                    fn(first + j, find_impl(keys[first + j], hashes[j]));
+                }
+            }
+        }
+
+        static void prefetch(void const *p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(p);
+#elif defined(DATAPOD_HASH_SSE2)
+            _mm_prefetch(static_cast<char const *>(p), _MM_HINT_T0);
+#else
+            (void)p;
+#endif
+        }
+
         template <class InputIt> void insert(InputIt first, InputIt last) {
             for (; first != last; ++first) {
                 emplace(*first);
@@ -354,6 +527,16 @@ namespace datapod {
 
         template <typename Key> datapod::usize erase(Key &&key) { return erase_impl(std::forward<Key>(key)); }
 
+        // erase() with hash == hash_of(key)
+        template <typename Key> datapod::usize erase(Key const &key, size_type const hash) {
+            auto const it = find_impl(key, hash);
+            if (it == end()) {
+                return 0U;
+            }
+            erase(it);
+            return 1U;
+        }
+
         void erase(iterator const it) noexcept {
             it.entry_->~T();
             erase_meta_only(it);
@@ -365,7 +548,17 @@ namespace datapod {
             auto entry = T{std::forward<Args>(args)...};
             auto res = find_or_prepare_insert(GetKey()(entry));
             if (res.second) {
-                new (entries_ + res.first) T{std::move(entry)};
+                new (entries() + res.first) T{std::move(entry)};
+            }
+            return {iterator_at(res.first), res.second};
+        }
+
+        // emplace() with hash == hash_of(key of the constructed entry); a wrong hash corrupts the table
+        template <typename... Args> std::pair<iterator, bool> emplace_hint_hash(size_type const hash, Args &&...args) {
+            auto entry = T{std::forward<Args>(args)...};
+            auto res = find_or_prepare_insert(GetKey()(entry), hash);
+            if (res.second) {
+                new (entries() + res.first) T{std::move(entry)};
             }
             return {iterator_at(res.first), res.second};
         }
@@ -377,7 +570,7 @@ namespace datapod {
             }
             return it;
         }
-        iterator end() noexcept { return {ctrl_ + capacity_}; }
+        iterator end() noexcept { return {ctrl() + capacity_}; }
 
         const_iterator begin() const noexcept { return const_cast<HashStorage *>(this)->begin(); }
         const_iterator end() const noexcept { return const_cast<HashStorage *>(this)->end(); }
@@ -398,14 +591,14 @@ namespace datapod {
 
         bool was_never_full(datapod::usize const index) const noexcept {
             auto const index_before = (index - WIDTH) & capacity_;
-            auto const empty_after = group{ctrl_ + index}.match_empty();
-            auto const empty_before = group{ctrl_ + index_before}.match_empty();
+            auto const empty_after = group{ctrl() + index}.match_empty();
+            auto const empty_before = group{ctrl() + index_before}.match_empty();
             return empty_before && empty_after && (empty_after.trailing_zeros() + empty_before.leading_zeros()) < WIDTH;
         }
 
         void erase_meta_only(const_iterator it) noexcept {
             --size_;
-            auto const index = static_cast<datapod::usize>(it.inner_.ctrl_ - ctrl_);
+            auto const index = static_cast<datapod::usize>(it.inner_.ctrl_ - ctrl());
             auto const wnf = was_never_full(index);
             set_ctrl(index, static_cast<h2_t>(wnf ? EMPTY : DELETED));
             growth_left_ += wnf;
@@ -417,26 +610,30 @@ namespace datapod {
             }
 
             for (size_type i = 0U; i != capacity_; ++i) {
-                if (is_full(ctrl_[i])) {
-                    entries_[i].~T();
+                if (is_full(ctrl()[i])) {
+                    entries()[i].~T();
                 }
             }
 
             if (self_allocated_) {
-                aligned_free(ALIGNMENT, entries_);
+                aligned_free(ALIGNMENT, entries());
             }
 
             partial_reset();
         }
 
         template <typename Key> std::pair<size_type, bool> find_or_prepare_insert(Key &&key) {
-            auto const hash = compute_hash(key);
+            return find_or_prepare_insert(key, compute_hash(key));
+        }
+
+        template <typename Key>
+        std::pair<size_type, bool> find_or_prepare_insert(Key const &key, size_type const hash) {
             // Search for key - if found, return its position
             for (auto seq = probe_seq{h1(hash), capacity_}; true; seq.next()) {
-                group g{ctrl_ + seq.offset_};
+                group g{ctrl() + seq.offset_};
                 // Check if key already exists in this group
                 for (auto const i : g.match(h2(hash))) {
-                    if (Eq{}(GetKey()(entries_[seq.offset(i)]), key)) {
+                    if (Eq{}(GetKey()(entries()[seq.offset(i)]), key)) {
                         return {seq.offset(i), false}; // Found existing key
                     }
                 }
@@ -453,7 +650,7 @@ namespace datapod {
             // Probe until we find an empty or deleted slot
             // Note: Swiss tables guarantee we'll always find one if growth logic is correct
             for (auto seq = probe_seq{h1(hash), capacity_};; seq.next()) {
-                auto const mask = group{ctrl_ + seq.offset_}.match_empty_or_deleted();
+                auto const mask = group{ctrl() + seq.offset_}.match_empty_or_deleted();
                 if (mask) {
                     return {seq.offset(*mask), seq.index_};
                 }
@@ -472,18 +669,18 @@ namespace datapod {
 
             auto target = find_first_non_full(hash);
             ++size_;
-            growth_left_ -= (is_empty(ctrl_[target.offset_]) ? 1U : 0U);
+            growth_left_ -= (is_empty(ctrl()[target.offset_]) ? 1U : 0U);
             set_ctrl(target.offset_, h2(hash));
             return target.offset_;
         }
 
         void set_ctrl(size_type const i, h2_t const c) noexcept {
-            ctrl_[i] = static_cast<ctrl_t>(c);
+            ctrl()[i] = static_cast<ctrl_t>(c);
             // For wraparound: mirror the first WIDTH-1 bytes after the END marker
-            // ctrl_[capacity] is the END marker and should never be modified
-            // ctrl_[capacity+1..capacity+WIDTH-1] mirrors ctrl_[0..WIDTH-2]
+            // ctrl()[capacity] is the END marker and should never be modified
+            // ctrl()[capacity+1..capacity+WIDTH-1] mirrors ctrl()[0..WIDTH-2]
             if (i < WIDTH - 1U) {
-                ctrl_[capacity_ + 1U + i] = static_cast<ctrl_t>(c);
+                ctrl()[capacity_ + 1U + i] = static_cast<ctrl_t>(c);
             }
         }
 
@@ -492,8 +689,8 @@ namespace datapod {
         void reset_growth_left() noexcept { growth_left_ = capacity_to_growth(capacity_) - size_; }
 
         void reset_ctrl() noexcept {
-            std::memset(ctrl_, EMPTY, static_cast<datapod::usize>(capacity_ + WIDTH + 1U));
-            ctrl_[capacity_] = END;
+            std::memset(ctrl(), EMPTY, static_cast<datapod::usize>(capacity_ + WIDTH + 1U));
+            ctrl()[capacity_] = END;
         }
 
         void initialize_entries() {
@@ -503,14 +700,14 @@ namespace datapod {
             if (entries_ == nullptr) {
                 throw_exception(std::bad_alloc{});
             }
-            ctrl_ = reinterpret_cast<ctrl_t *>(reinterpret_cast<datapod::u8 *>(entries_) + capacity_ * sizeof(T));
+            ctrl_ = reinterpret_cast<ctrl_t *>(reinterpret_cast<datapod::u8 *>(entries()) + capacity_ * sizeof(T));
             reset_ctrl();
             reset_growth_left();
         }
 
         void resize(size_type const new_capacity) {
-            auto const old_ctrl = ctrl_;
-            auto const old_entries = entries_;
+            auto const old_ctrl = ctrl();
+            auto const old_entries = entries();
             auto const old_capacity = capacity_;
             auto const old_self_allocated = self_allocated_;
 
@@ -523,7 +720,7 @@ namespace datapod {
                     auto const target = find_first_non_full(hash);
                     auto const new_index = target.offset_;
                     set_ctrl(new_index, h2(hash));
-                    new (entries_ + new_index) T{std::move(old_entries[i])};
+                    new (entries() + new_index) T{std::move(old_entries[i])};
                     old_entries[i].~T();
                 }
             }
@@ -548,14 +745,19 @@ namespace datapod {
 
         void rehash() { resize(capacity_); }
 
-        iterator iterator_at(size_type const i) noexcept { return {ctrl_ + i, entries_ + i}; }
-        const_iterator iterator_at(size_type const i) const noexcept { return {ctrl_ + i, entries_ + i}; }
+        iterator iterator_at(size_type const i) noexcept { return {ctrl() + i, entries() + i}; }
+        const_iterator iterator_at(size_type const i) const noexcept { return {ctrl() + i, entries() + i}; }
 
         // Lookup - contains()
         template <typename Key> bool contains(Key &&key) const { return find(std::forward<Key>(key)) != end(); }
 
         bool contains(key_type const &key) const { return find(key) != end(); }
 
+        // contains() with hash == hash_of(key)
+        template <typename Key> bool contains(Key const &key, size_type const hash) const {
+            return find(key, hash) != end();
+        }
+
         // Lookup - count()
         template <typename Key> size_type count(Key &&key) const { return contains(std::forward<Key>(key)) ? 1U : 0U; }
 
@@ -606,10 +808,10 @@ namespace datapod {
             auto res = find_or_prepare_insert(key);
             if (res.second) {
                 // New insertion
-                new (entries_ + res.first) T{key, std::forward<M>(obj)};
+                new (entries() + res.first) T{key, std::forward<M>(obj)};
             } else {
                 // Update existing
-                GetValue{}(entries_[res.first]) = std::forward<M>(obj);
+                GetValue{}(entries()[res.first]) = std::forward<M>(obj);
             }
             return {iterator_at(res.first), res.second};
         }
@@ -618,10 +820,10 @@ namespace datapod {
             auto res = find_or_prepare_insert(key);
             if (res.second) {
                 // New insertion
-                new (entries_ + res.first) T{std::move(key), std::forward<M>(obj)};
+                new (entries() + res.first) T{std::move(key), std::forward<M>(obj)};
             } else {
                 // Update existing
-                GetValue{}(entries_[res.first]) = std::forward<M>(obj);
+                GetValue{}(entries()[res.first]) = std::forward<M>(obj);
             }
             return {iterator_at(res.first), res.second};
         }
@@ -631,7 +833,7 @@ namespace datapod {
             auto res = find_or_prepare_insert(key);
             if (res.second) {
                 // Only emplace if key doesn't exist
-                new (entries_ + res.first) T{key, mapped_type{std::forward<Args>(args)...}};
+                new (entries() + res.first) T{key, mapped_type{std::forward<Args>(args)...}};
             }
             return {iterator_at(res.first), res.second};
         }
@@ -640,7 +842,7 @@ namespace datapod {
             auto res = find_or_prepare_insert(key);
             if (res.second) {
                 // Only emplace if key doesn't exist
-                new (entries_ + res.first) T{std::move(key), mapped_type{std::forward<Args>(args)...}};
+                new (entries() + res.first) T{std::move(key), mapped_type{std::forward<Args>(args)...}};
             }
             return {iterator_at(res.first), res.second};
         }
@@ -658,6 +860,10 @@ namespace datapod {
             return true;
         }
 
+        // Raw views of the slot arrays (entries_/ctrl_ may be offset pointers)
+        T *entries() const noexcept { return to_ptr(entries_); }
+        ctrl_t *ctrl() const noexcept { return to_ptr(ctrl_); }
+
         // Serialization support
         auto members() noexcept { return std::tie(entries_, ctrl_, size_, capacity_, growth_left_, self_allocated_); }
 
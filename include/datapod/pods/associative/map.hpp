@@ -17,6 +17,7 @@ namespace datapod {
     };
 
     // Map using raw pointers (default)
+    // Not thread-safe; ConcurrentMap in pods/lockfree shards maps shared between threads
     template <typename Key, typename Value, typename Hash = Hasher<Key>, typename Eq = EqualTo<Key>>
     using Map = HashStorage<Pair<Key, Value>, raw::ptr, GetFirst, GetSecond, Hash, Eq>;
 
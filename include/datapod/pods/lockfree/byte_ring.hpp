@@ -0,0 +1,461 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <datapod/core/next_power_of_2.hpp>
+#include <datapod/pods/adapters/error.hpp>
+#include <datapod/pods/adapters/result.hpp>
+#include <datapod/pods/lockfree/ring_buffer.hpp>
+#include <datapod/pods/sequential/string.hpp>
+
+namespace datapod {
+
+    // ============================================================================
+    // ByteRing - variable-length records (SPSC or MPSC)
+    // ============================================================================
+    //
+    // A ring of bytes carrying length-prefixed records, for payloads whose size varies from
+    // message to message (e.g. serialize() output). Producers reserve(len) room, write the
+    // payload in place and commit() it; the consumer peek()s the next record in place and
+    // consume()s it, so a message is written once and never copied through the ring.
+    //
+    // Records are an 8-byte header (size, type) followed by the payload, padded to 8 bytes.
+    // A record never wraps: when it does not fit before the end of the buffer, a padding record
+    // fills the tail and the record starts over at offset 0. To guarantee that every record
+    // eventually fits, a record may take at most half the capacity (max_record()).
+    //
+    // SPSC: the producer publishes write_pos on commit, as RingBuffer<SPSC> does.
+    // MPSC: producers claim space with one CAS on write_pos and may commit out of order; a record
+    // is ready once its size word is non-zero. The consumer zeroes each record it consumes, so
+    // stale bytes are never mistaken for a committed header on the next lap.
+
+    template <typename Policy> class ByteRing {
+        static_assert(std::is_same_v<Policy, SPSC> || std::is_same_v<Policy, MPSC>, "ByteRing supports SPSC and MPSC");
+
+      public:
+        // Room for one record: fill data[0, size), then commit() (or cancel()) it
+        struct Reservation {
+            uint8_t *data = nullptr;
+            size_t size = 0;
+            uint64_t pos = 0;
+
+            explicit operator bool() const noexcept { return data != nullptr; }
+        };
+
+        // The next committed record, valid until consume()
+        struct Record {
+            const uint8_t *data = nullptr;
+            size_t size = 0;
+
+            explicit operator bool() const noexcept { return data != nullptr; }
+        };
+
+        static constexpr size_t RECORD_ALIGN = 8;
+        static constexpr size_t RECORD_HEADER = 8;
+
+        ByteRing() noexcept
+            : header_(nullptr), data_(nullptr), owns_memory_(false), is_shm_(false), shm_fd_(-1), shm_size_(0) {}
+        explicit ByteRing(size_t capacity, const RingOptions &options = RingOptions{});
+        static Result<ByteRing, Error> create_shm(const String &name, size_t capacity,
+                                                  const RingOptions &options = RingOptions{});
+        static Result<ByteRing, Error> attach_shm(const String &name, const RingOptions &options = RingOptions{});
+        ~ByteRing();
+
+        ByteRing(ByteRing &&other) noexcept;
+        ByteRing &operator=(ByteRing &&other) noexcept;
+        ByteRing(const ByteRing &) = delete;
+        ByteRing &operator=(const ByteRing &) = delete;
+
+        // Producer side; an empty Reservation when the ring is full or len > max_record()
+        inline Reservation reserve(size_t len) noexcept;
+        inline void commit(const Reservation &r) noexcept;
+        // Give the reserved room back as padding, e.g. when filling it failed
+        inline void cancel(const Reservation &r) noexcept;
+        inline bool try_push(const void *data, size_t len) noexcept;
+
+        // Consumer side (one consumer)
+        inline Record peek() noexcept;
+        inline void consume() noexcept;
+
+        // Claimed but uncommitted MPSC records count as in use
+        inline bool empty() const noexcept;
+        // Bytes in use, headers and padding included
+        inline size_t used() const noexcept;
+        inline size_t capacity() const noexcept;
+        inline size_t max_record() const noexcept;
+
+      private:
+        struct alignas(64) Header {
+            std::atomic<uint64_t> write_pos;
+            uint8_t padding1[64 - sizeof(std::atomic<uint64_t>)];
+
+            std::atomic<uint64_t> read_pos;
+            uint8_t padding2[64 - sizeof(std::atomic<uint64_t>)];
+
+            uint64_t capacity;
+            uint32_t magic;
+            uint32_t version;
+
+            Header() : write_pos(0), read_pos(0), capacity(0), magic(MAGIC), version(1) {}
+        };
+
+        // size: header + payload bytes, 0 while an MPSC record is not committed yet
+        struct RecordHeader {
+            std::atomic<uint32_t> size;
+            uint32_t type;
+        };
+
+        static constexpr uint32_t DATA = 0;
+        static constexpr uint32_t PADDING = 1;
+        static constexpr uint32_t MAGIC = std::is_same_v<Policy, SPSC> ? 0x42525331 : 0x42524D31;
+
+        Header *header_;
+        uint8_t *data_;
+        bool owns_memory_;
+        bool is_shm_;
+        int shm_fd_;
+        size_t shm_size_; // Mapping length: the shm segment, or an in-process ring built with RingOptions
+        String shm_name_;
+
+        // Each side's stale view of the other side's position (SPSC only), on its own cache line
+        alignas(64) uint64_t cached_read_pos_ = 0;
+        alignas(64) uint64_t cached_write_pos_ = 0;
+
+        static inline size_t calculate_shm_size(size_t capacity) noexcept { return sizeof(Header) + capacity; }
+
+        // A power of two of at least 64 bytes, so records stay 8-byte aligned and positions mask
+        static inline size_t round_capacity(size_t capacity) noexcept {
+            return capacity <= 64 ? 64 : next_power_of_two(capacity);
+        }
+
+        static inline size_t record_span(size_t size) noexcept {
+            return (size + RECORD_ALIGN - 1) / RECORD_ALIGN * RECORD_ALIGN;
+        }
+
+        inline void init_header(size_t capacity) noexcept {
+            header_->write_pos.store(0, std::memory_order_relaxed);
+            header_->read_pos.store(0, std::memory_order_relaxed);
+            header_->capacity = capacity;
+            header_->magic = MAGIC;
+            header_->version = 1;
+            std::memset(data_, 0, capacity);
+        }
+
+        inline bool verify_header() const noexcept { return header_->magic == MAGIC && header_->version == 1; }
+
+        inline RecordHeader *record_at(uint64_t pos) const noexcept {
+            return reinterpret_cast<RecordHeader *>(data_ + (pos & (header_->capacity - 1)));
+        }
+
+    };
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    template <typename Policy>
+    ByteRing<Policy>::ByteRing(size_t capacity, const RingOptions &options)
+        : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
+        capacity = round_capacity(capacity);
+
+        size_t total_size = calculate_shm_size(capacity);
+        void *mem = ring_memory::allocate(total_size, options, shm_size_);
+        if (!mem) {
+            header_ = nullptr;
+            data_ = nullptr;
+            return;
+        }
+
+        header_ = new (mem) Header();
+        data_ = static_cast<uint8_t *>(mem) + sizeof(Header);
+        init_header(capacity);
+    }
+
+    template <typename Policy>
+    Result<ByteRing<Policy>, Error> ByteRing<Policy>::create_shm(const String &name, size_t capacity,
+                                                                 const RingOptions &options) {
+        if (capacity == 0) {
+            return Result<ByteRing, Error>::err(Error::invalid_argument("Capacity must be > 0"));
+        }
+
+        if (name.empty() || name[0] != '/') {
+            return Result<ByteRing, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
+        }
+
+        capacity = round_capacity(capacity);
+        size_t total_size = calculate_shm_size(capacity);
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+        if (fd < 0) {
+            if (errno == EEXIST) {
+                return Result<ByteRing, Error>::err(Error::already_exists("Shared memory already exists"));
+            }
+            return Result<ByteRing, Error>::err(Error::io_error("shm_open failed"));
+        }
+
+        if (ftruncate(fd, total_size) < 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return Result<ByteRing, Error>::err(Error::io_error("ftruncate failed"));
+        }
+
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return Result<ByteRing, Error>::err(Error::io_error("mmap failed"));
+        }
+        ring_memory::prepare(addr, total_size, options, true);
+
+        ByteRing ring;
+        ring.header_ = new (addr) Header();
+        ring.data_ = static_cast<uint8_t *>(addr) + sizeof(Header);
+        ring.owns_memory_ = true;
+        ring.is_shm_ = true;
+        ring.shm_fd_ = fd;
+        ring.shm_size_ = total_size;
+        ring.shm_name_ = name;
+        ring.init_header(capacity);
+
+        return Result<ByteRing, Error>::ok(std::move(ring));
+    }
+
+    template <typename Policy>
+    Result<ByteRing<Policy>, Error> ByteRing<Policy>::attach_shm(const String &name, const RingOptions &options) {
+        if (name.empty() || name[0] != '/') {
+            return Result<ByteRing, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
+        }
+
+        int fd = shm_open(name.c_str(), O_RDWR, 0666);
+        if (fd < 0) {
+            return Result<ByteRing, Error>::err(Error::not_found("Shared memory not found"));
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) < 0) {
+            close(fd);
+            return Result<ByteRing, Error>::err(Error::io_error("fstat failed"));
+        }
+        size_t total_size = st.st_size;
+
+        int flags = options.populate ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            return Result<ByteRing, Error>::err(Error::io_error("mmap failed"));
+        }
+        ring_memory::prepare(addr, total_size, options, false);
+
+        ByteRing ring;
+        ring.header_ = static_cast<Header *>(addr);
+        ring.data_ = static_cast<uint8_t *>(addr) + sizeof(Header);
+        ring.owns_memory_ = false;
+        ring.is_shm_ = true;
+        ring.shm_fd_ = fd;
+        ring.shm_size_ = total_size;
+        ring.shm_name_ = name;
+
+        if (total_size < sizeof(Header) || !ring.verify_header()) {
+            munmap(addr, total_size);
+            close(fd);
+            ring.header_ = nullptr;
+            return Result<ByteRing, Error>::err(Error::invalid_argument("Invalid byte ring header (magic mismatch)"));
+        }
+        ring.cached_read_pos_ = ring.header_->read_pos.load(std::memory_order_acquire);
+        ring.cached_write_pos_ = ring.header_->write_pos.load(std::memory_order_acquire);
+
+        return Result<ByteRing, Error>::ok(std::move(ring));
+    }
+
+    template <typename Policy> ByteRing<Policy>::~ByteRing() {
+        if (is_shm_) {
+            if (header_)
+                munmap(header_, shm_size_);
+            if (shm_fd_ >= 0)
+                close(shm_fd_);
+            if (owns_memory_ && !shm_name_.empty())
+                shm_unlink(shm_name_.c_str());
+        } else {
+            if (header_)
+                ring_memory::release(header_, shm_size_);
+        }
+    }
+
+    template <typename Policy>
+    ByteRing<Policy>::ByteRing(ByteRing &&other) noexcept
+        : header_(other.header_), data_(other.data_), owns_memory_(other.owns_memory_), is_shm_(other.is_shm_),
+          shm_fd_(other.shm_fd_), shm_size_(other.shm_size_), shm_name_(std::move(other.shm_name_)),
+          cached_read_pos_(other.cached_read_pos_), cached_write_pos_(other.cached_write_pos_) {
+        other.header_ = nullptr;
+        other.data_ = nullptr;
+        other.shm_fd_ = -1;
+        other.owns_memory_ = false;
+        other.is_shm_ = false;
+    }
+
+    template <typename Policy> ByteRing<Policy> &ByteRing<Policy>::operator=(ByteRing &&other) noexcept {
+        if (this != &other) {
+            this->~ByteRing();
+            header_ = other.header_;
+            data_ = other.data_;
+            owns_memory_ = other.owns_memory_;
+            is_shm_ = other.is_shm_;
+            shm_fd_ = other.shm_fd_;
+            shm_size_ = other.shm_size_;
+            shm_name_ = std::move(other.shm_name_);
+            cached_read_pos_ = other.cached_read_pos_;
+            cached_write_pos_ = other.cached_write_pos_;
+            other.header_ = nullptr;
+            other.data_ = nullptr;
+            other.shm_fd_ = -1;
+            other.owns_memory_ = false;
+            other.is_shm_ = false;
+        }
+        return *this;
+    }
+
+    template <typename Policy>
+    inline typename ByteRing<Policy>::Reservation ByteRing<Policy>::reserve(size_t len) noexcept {
+        if (len > max_record()) {
+            return Reservation{};
+        }
+        const size_t span = record_span(RECORD_HEADER + len);
+        const uint64_t capacity = header_->capacity;
+
+        // A record that does not fit before the end of the buffer also claims the tail as padding
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        size_t tail;
+        while (true) {
+            tail = capacity - (w & (capacity - 1));
+            const size_t need = span <= tail ? span : tail + span;
+            if constexpr (std::is_same_v<Policy, SPSC>) {
+                if (w + need - cached_read_pos_ > capacity) {
+                    cached_read_pos_ = header_->read_pos.load(std::memory_order_acquire);
+                    if (w + need - cached_read_pos_ > capacity) {
+                        return Reservation{};
+                    }
+                }
+                break;
+            } else {
+                uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+                if (w + need - r > capacity) {
+                    return Reservation{};
+                }
+                if (header_->write_pos.compare_exchange_weak(w, w + need, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+
+        if (span > tail) {
+            RecordHeader *pad = record_at(w);
+            pad->type = PADDING;
+            pad->size.store(static_cast<uint32_t>(tail), std::memory_order_release);
+            w += tail;
+        }
+        return Reservation{data_ + (w & (capacity - 1)) + RECORD_HEADER, len, w};
+    }
+
+    template <typename Policy> inline void ByteRing<Policy>::commit(const Reservation &r) noexcept {
+        RecordHeader *rec = record_at(r.pos);
+        rec->type = DATA;
+        rec->size.store(static_cast<uint32_t>(RECORD_HEADER + r.size), std::memory_order_release);
+        if constexpr (std::is_same_v<Policy, SPSC>) {
+            header_->write_pos.store(r.pos + record_span(RECORD_HEADER + r.size), std::memory_order_release);
+        }
+    }
+
+    template <typename Policy> inline void ByteRing<Policy>::cancel(const Reservation &r) noexcept {
+        RecordHeader *rec = record_at(r.pos);
+        rec->type = PADDING;
+        rec->size.store(static_cast<uint32_t>(RECORD_HEADER + r.size), std::memory_order_release);
+        if constexpr (std::is_same_v<Policy, SPSC>) {
+            header_->write_pos.store(r.pos + record_span(RECORD_HEADER + r.size), std::memory_order_release);
+        }
+    }
+
+    template <typename Policy> inline bool ByteRing<Policy>::try_push(const void *data, size_t len) noexcept {
+        auto r = reserve(len);
+        if (!r) {
+            return false;
+        }
+        if (len != 0) {
+            std::memcpy(r.data, data, len);
+        }
+        commit(r);
+        return true;
+    }
+
+    template <typename Policy> inline typename ByteRing<Policy>::Record ByteRing<Policy>::peek() noexcept {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        while (true) {
+            uint32_t size;
+            if constexpr (std::is_same_v<Policy, SPSC>) {
+                if (r == cached_write_pos_) {
+                    cached_write_pos_ = header_->write_pos.load(std::memory_order_acquire);
+                    if (r == cached_write_pos_) {
+                        return Record{};
+                    }
+                }
+                size = record_at(r)->size.load(std::memory_order_relaxed);
+            } else {
+                size = record_at(r)->size.load(std::memory_order_acquire);
+                if (size == 0) {
+                    return Record{}; // Nothing claimed here yet, or claimed but not committed
+                }
+            }
+
+            RecordHeader *rec = record_at(r);
+            if (rec->type != PADDING) {
+                return Record{reinterpret_cast<const uint8_t *>(rec) + RECORD_HEADER, size - RECORD_HEADER};
+            }
+
+            // Skip padding (wrap-around fill or a cancelled reservation)
+            size_t span = record_span(size);
+            if constexpr (std::is_same_v<Policy, MPSC>) {
+                std::memset(static_cast<void *>(rec), 0, span);
+            }
+            r += span;
+            header_->read_pos.store(r, std::memory_order_release);
+        }
+    }
+
+    template <typename Policy> inline void ByteRing<Policy>::consume() noexcept {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        RecordHeader *rec = record_at(r);
+        size_t span = record_span(rec->size.load(std::memory_order_relaxed));
+        if constexpr (std::is_same_v<Policy, MPSC>) {
+            std::memset(static_cast<void *>(rec), 0, span);
+        }
+        header_->read_pos.store(r + span, std::memory_order_release);
+    }
+
+    template <typename Policy> inline bool ByteRing<Policy>::empty() const noexcept {
+        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+        return w == r;
+    }
+
+    template <typename Policy> inline size_t ByteRing<Policy>::used() const noexcept {
+        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+        return w - r;
+    }
+
+    template <typename Policy> inline size_t ByteRing<Policy>::capacity() const noexcept { return header_->capacity; }
+
+    template <typename Policy> inline size_t ByteRing<Policy>::max_record() const noexcept {
+        size_t half = header_->capacity / 2 - RECORD_HEADER;
+        return half < UINT32_MAX - RECORD_HEADER ? half : UINT32_MAX - RECORD_HEADER;
+    }
+
+} // namespace datapod
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include <datapod/core/next_power_of_2.hpp>
+#include <datapod/pods/adapters/optional.hpp>
+#include <datapod/pods/associative/map.hpp>
+
+namespace datapod {
+
+    // ============================================================================
+    // ConcurrentMap - hash map shared between threads, sharded over Map instances
+    // ============================================================================
+    //
+    // The key space is split over a power-of-two number of shards by the top bits of the key's
+    // hash; each shard is an ordinary Map with its own lock, on its own cache lines, so threads
+    // working on different keys rarely touch the same lock. The hash is computed once per call
+    // and reused by the shard's Map (find(key, hash) / emplace_hint_hash).
+    //
+    // When Key and Value are both trivially copyable, get() and contains() are optimistic seqlock
+    // reads: writers bump the shard's sequence to odd before and to even after each change; a
+    // reader copies the value between two reads of the sequence and retries if it moved, falling
+    // back to the shard's lock after a few failed attempts so a busy writer cannot starve it.
+    // Since readers rarely lock, that lock is a plain std::mutex (glibc's rwlock write path costs
+    // about twice as much once several threads use it). Other maps guard each shard with a
+    // std::shared_mutex that readers take shared.
+    //
+    // An optimistic reader may still be probing a shard's table while a writer outgrows it, so in
+    // that mode a full table is never resized in place: the writer builds a table twice the size,
+    // publishes it and keeps the old one on a chain that is freed with the map (like the arrays of
+    // WorkStealingDeque; since tables double, the chain adds up to less than the live table).
+    // clear() erases in place for the same reason.
+
+    template <typename Key, typename Value, typename Hash = Hasher<Key>, typename Eq = EqualTo<Key>>
+    class ConcurrentMap {
+        using Table = Map<Key, Value, Hash, Eq>;
+
+      public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using size_type = size_t;
+
+        // Whether get() and contains() read without taking a lock
+        static constexpr bool OPTIMISTIC_READS =
+            std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>;
+
+        explicit ConcurrentMap(size_t shards = 64);
+        ~ConcurrentMap();
+
+        ConcurrentMap(const ConcurrentMap &) = delete;
+        ConcurrentMap &operator=(const ConcurrentMap &) = delete;
+
+        // Readers
+        inline Optional<Value> get(const Key &key) const;
+        inline bool contains(const Key &key) const;
+
+        // Calls fn(const Value &) under the shard's lock, returns whether the key was found
+        template <typename Fn> bool visit(const Key &key, Fn &&fn) const;
+
+        // Writers; insert() leaves an existing value alone, both return whether the key was new
+        inline bool insert(const Key &key, const Value &value);
+        inline bool insert_or_assign(const Key &key, const Value &value);
+
+        // Calls fn(Value &) on the key's value under the shard's lock, returns whether it existed
+        template <typename Fn> bool update(const Key &key, Fn &&fn);
+
+        // Like update(), inserting a value-initialized Value first if the key is absent; returns whether it was
+        template <typename Fn> bool upsert(const Key &key, Fn &&fn);
+
+        inline bool erase(const Key &key);
+        void clear();
+
+        // Calls fn(const Key &, const Value &) for every entry, one shard at a time under its lock
+        template <typename Fn> void for_each(Fn &&fn) const;
+
+        // Sum over the shards, exact only when no other thread is writing
+        size_t size() const;
+        bool empty() const { return size() == 0; }
+        size_t shard_count() const noexcept { return mask_ + 1; }
+
+      private:
+        struct Node {
+            Table table;
+            Node *prev; // The table this one replaced, still readable by slow optimistic readers
+        };
+
+        using Mutex = std::conditional_t<OPTIMISTIC_READS, std::mutex, std::shared_mutex>;
+        using ReadLock = std::conditional_t<OPTIMISTIC_READS, std::unique_lock<Mutex>, std::shared_lock<Mutex>>;
+        using WriteLock = std::unique_lock<Mutex>;
+
+        // Padded to whole cache lines so neighbouring shards' locks do not share one
+        struct alignas(64) Shard {
+            mutable Mutex mutex;
+            std::atomic<uint64_t> seq{0}; // Odd while a writer is changing the table
+            std::atomic<Node *> node{nullptr};
+        };
+
+        static constexpr int OPTIMISTIC_ATTEMPTS = 4;
+
+        size_t mask_;
+        unsigned shift_; // 64 - log2(shards): the shard is the top bits of the hash
+        Shard *shards_;
+
+        Shard &shard_for(hash_t hash) const noexcept { return shards_[shift_ == 64 ? 0 : (hash >> shift_) & mask_]; }
+        static Table &table(Shard &s) noexcept { return s.node.load(std::memory_order_relaxed)->table; }
+
+        static inline void begin_write(Shard &s) noexcept;
+        static inline void end_write(Shard &s) noexcept;
+
+        // Keeps the shard's sequence odd for its lifetime and closes it even when the change throws,
+        // so a failed update never leaves the parity reversed for later writers
+        struct WriteSection {
+            explicit WriteSection(Shard &shard) noexcept : s(shard) { begin_write(s); }
+            ~WriteSection() { end_write(s); }
+            WriteSection(const WriteSection &) = delete;
+            WriteSection &operator=(const WriteSection &) = delete;
+
+            Shard &s;
+        };
+
+        Table &writable(Shard &s, const Key &key, hash_t hash);
+        template <typename Fn> bool read(const Key &key, Fn &&fn) const;
+    };
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    ConcurrentMap<Key, Value, Hash, Eq>::ConcurrentMap(size_t shards) {
+        shards = shards <= 1 ? 1 : next_power_of_two(shards);
+        mask_ = shards - 1;
+        shift_ = 64;
+        while ((size_t{1} << (64 - shift_)) < shards) {
+            --shift_;
+        }
+        shards_ = new Shard[shards];
+        for (size_t i = 0; i < shards; i++) {
+            shards_[i].node.store(new Node{Table{}, nullptr}, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    ConcurrentMap<Key, Value, Hash, Eq>::~ConcurrentMap() {
+        for (size_t i = 0; i <= mask_; i++) {
+            Node *n = shards_[i].node.load(std::memory_order_relaxed);
+            while (n) {
+                Node *prev = n->prev;
+                delete n;
+                n = prev;
+            }
+        }
+        delete[] shards_;
+    }
+
+    // Same protocol as the Broadcast ring's slots: odd sequence, the change, even sequence
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline void ConcurrentMap<Key, Value, Hash, Eq>::begin_write(Shard &s) noexcept {
+        if constexpr (OPTIMISTIC_READS) {
+            s.seq.store(s.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline void ConcurrentMap<Key, Value, Hash, Eq>::end_write(Shard &s) noexcept {
+        if constexpr (OPTIMISTIC_READS) {
+            s.seq.store(s.seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+    }
+
+    // The shard's table, ready to take one more key without resizing in place. Called under the
+    // write lock, outside a WriteSection: the new table is private until it is published.
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    typename ConcurrentMap<Key, Value, Hash, Eq>::Table &
+    ConcurrentMap<Key, Value, Hash, Eq>::writable(Shard &s, const Key &key, hash_t hash) {
+        Node *n = s.node.load(std::memory_order_relaxed);
+        if constexpr (OPTIMISTIC_READS) {
+            if (n->table.growth_left_ == 0 && !n->table.contains(key, hash)) {
+                Node *bigger = new Node{Table{}, n};
+                bigger->table.reserve(n->table.capacity() * 2 + 1);
+                for (auto const &entry : n->table) {
+                    bigger->table.emplace_hint_hash(bigger->table.hash_of(entry.first), entry.first, entry.second);
+                }
+                {
+                    WriteSection section(s);
+                    s.node.store(bigger, std::memory_order_release);
+                }
+                n = bigger;
+            }
+        }
+        return n->table;
+    }
+
+    // fn(const Value *) with the key's value or nullptr, optimistically when possible
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    template <typename Fn>
+    bool ConcurrentMap<Key, Value, Hash, Eq>::read(const Key &key, Fn &&fn) const {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        if constexpr (OPTIMISTIC_READS) {
+            for (int attempt = 0; attempt < OPTIMISTIC_ATTEMPTS; attempt++) {
+                uint64_t const before = s.seq.load(std::memory_order_acquire);
+                if (before & 1) {
+                    continue; // A writer is mid-change
+                }
+                Table const &t = s.node.load(std::memory_order_acquire)->table;
+                auto const it = t.find(key, hash);
+                bool const found = it != t.end();
+                Optional<Value> copy;
+                if (found) {
+                    copy = it->second;
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (s.seq.load(std::memory_order_relaxed) == before) {
+                    return fn(found ? &*copy : nullptr);
+                }
+            }
+        }
+        ReadLock lock(s.mutex);
+        Table const &t = table(s);
+        auto const it = t.find(key, hash);
+        return fn(it == t.end() ? nullptr : &it->second);
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline Optional<Value> ConcurrentMap<Key, Value, Hash, Eq>::get(const Key &key) const {
+        Optional<Value> out;
+        read(key, [&](const Value *v) {
+            if (v) {
+                out = *v;
+            }
+            return v != nullptr;
+        });
+        return out;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline bool ConcurrentMap<Key, Value, Hash, Eq>::contains(const Key &key) const {
+        return read(key, [](const Value *v) { return v != nullptr; });
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    template <typename Fn>
+    bool ConcurrentMap<Key, Value, Hash, Eq>::visit(const Key &key, Fn &&fn) const {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        ReadLock lock(s.mutex);
+        Table const &t = table(s);
+        auto const it = t.find(key, hash);
+        if (it == t.end()) {
+            return false;
+        }
+        fn(it->second);
+        return true;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline bool ConcurrentMap<Key, Value, Hash, Eq>::insert(const Key &key, const Value &value) {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        WriteLock lock(s.mutex);
+        Table &t = writable(s, key, hash);
+        WriteSection section(s);
+        return t.emplace_hint_hash(hash, key, value).second;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline bool ConcurrentMap<Key, Value, Hash, Eq>::insert_or_assign(const Key &key, const Value &value) {
+        return upsert(key, [&](Value &v) { v = value; });
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    template <typename Fn>
+    bool ConcurrentMap<Key, Value, Hash, Eq>::update(const Key &key, Fn &&fn) {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        WriteLock lock(s.mutex);
+        Table &t = table(s);
+        auto const it = t.find(key, hash);
+        if (it == t.end()) {
+            return false;
+        }
+        WriteSection section(s);
+        fn(it->second);
+        return true;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    template <typename Fn>
+    bool ConcurrentMap<Key, Value, Hash, Eq>::upsert(const Key &key, Fn &&fn) {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        WriteLock lock(s.mutex);
+        Table &t = writable(s, key, hash);
+        WriteSection section(s);
+        auto const [it, inserted] = t.emplace_hint_hash(hash, key, Value{});
+        fn(it->second);
+        return inserted;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    inline bool ConcurrentMap<Key, Value, Hash, Eq>::erase(const Key &key) {
+        hash_t const hash = Hash{}(key);
+        Shard &s = shard_for(hash);
+        WriteLock lock(s.mutex);
+        Table &t = table(s);
+        auto const it = t.find(key, hash);
+        if (it == t.end()) {
+            return false;
+        }
+        WriteSection section(s);
+        t.erase(it);
+        return true;
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    void ConcurrentMap<Key, Value, Hash, Eq>::clear() {
+        for (size_t i = 0; i <= mask_; i++) {
+            Shard &s = shards_[i];
+            WriteLock lock(s.mutex);
+            Table &t = table(s);
+            WriteSection section(s);
+            for (auto it = t.begin(); it != t.end();) {
+                auto const next = std::next(it);
+                t.erase(it);
+                it = next;
+            }
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    template <typename Fn>
+    void ConcurrentMap<Key, Value, Hash, Eq>::for_each(Fn &&fn) const {
+        for (size_t i = 0; i <= mask_; i++) {
+            ReadLock lock(shards_[i].mutex);
+            for (auto const &entry : table(shards_[i])) {
+                fn(entry.first, entry.second);
+            }
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Eq>
+    size_t ConcurrentMap<Key, Value, Hash, Eq>::size() const {
+        size_t n = 0;
+        for (size_t i = 0; i <= mask_; i++) {
+            ReadLock lock(shards_[i].mutex);
+            n += table(shards_[i]).size();
+        }
+        return n;
+    }
+
+} // namespace datapod
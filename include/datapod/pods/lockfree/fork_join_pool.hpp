@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <datapod/pods/lockfree/wait_event.hpp>
+#include <datapod/pods/lockfree/work_stealing_deque.hpp>
+
+namespace datapod {
+
+    // ============================================================================
+    // ForkJoinPool - fork-join parallelism over WorkStealingDeques
+    // ============================================================================
+    //
+    // invoke(a, b) runs a and b, possibly in parallel, and returns once both are done: b is pushed
+    // on the current thread's deque where an idle worker can steal it, a runs inline, then b is
+    // popped back and run inline unless it was stolen. Recursive divide and conquer (bulk loading
+    // a tree, sorting, splitting a range) therefore only crosses threads when someone is idle.
+    // While a stolen b is still running, the waiting thread steals other work instead of blocking.
+    //
+    // operator()(n, task) runs task(i) for every i in [0, n) by recursive halving, which makes the
+    // pool an executor for serialize_parallel() / deserialize_parallel().
+    //
+    // Forked jobs live on the stack of the frame that forked them, so forking never allocates.
+    // An exception thrown by either side is rethrown by invoke() after both sides have finished.
+    //
+    // The pool has `threads` slots: threads - 1 workers plus one for the caller. Calls from outside
+    // the pool take the caller slot for their duration, so they are serialized against each other.
+
+    class ForkJoinPool {
+      public:
+        explicit ForkJoinPool(size_t threads = std::max(1U, std::thread::hardware_concurrency()));
+        ~ForkJoinPool();
+
+        ForkJoinPool(const ForkJoinPool &) = delete;
+        ForkJoinPool &operator=(const ForkJoinPool &) = delete;
+
+        template <typename A, typename B> void invoke(A &&a, B &&b);
+
+        template <typename Task> void operator()(size_t n, Task const &task);
+
+        inline size_t threads() const noexcept { return deques_.size(); }
+
+      private:
+        struct Job {
+            void (*execute)(Job *);
+            std::atomic<bool> done{false};
+            std::exception_ptr error;
+        };
+
+        template <typename F> struct StackJob : Job {
+            explicit StackJob(F &f) : fn(&f) { this->execute = &StackJob::run; }
+
+            static void run(Job *job) {
+                auto *self = static_cast<StackJob *>(job);
+                try {
+                    (*self->fn)();
+                } catch (...) {
+                    self->error = std::current_exception();
+                }
+                self->done.store(true, std::memory_order_release);
+            }
+
+            F *fn;
+        };
+
+        // Which pool slot the current thread owns, if any
+        struct Slot {
+            ForkJoinPool *pool = nullptr;
+            size_t index = 0;
+        };
+
+        static inline Slot &current() noexcept {
+            thread_local Slot slot;
+            return slot;
+        }
+
+        std::vector<std::unique_ptr<WorkStealingDeque<Job *>>> deques_;
+        std::vector<std::thread> workers_;
+        std::mutex caller_mutex_; // Guards slot 0 for threads outside the pool
+        std::atomic<bool> stop_{false};
+        WaitEvent idle_;
+
+        inline Job *steal_from_others(size_t self) noexcept;
+        inline bool has_work() const noexcept;
+        inline void worker_main(size_t index);
+        inline void join(size_t self, Job &job);
+        template <typename A, typename B> void invoke_in_slot(size_t self, A &a, B &b);
+
+        template <typename Task> void for_range(size_t lo, size_t hi, Task const &task);
+    };
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    inline ForkJoinPool::ForkJoinPool(size_t threads) {
+        threads = std::max<size_t>(1, threads);
+        for (size_t i = 0; i < threads; i++) {
+            deques_.push_back(std::make_unique<WorkStealingDeque<Job *>>());
+        }
+        for (size_t i = 1; i < threads; i++) {
+            workers_.emplace_back([this, i] { worker_main(i); });
+        }
+    }
+
+    inline ForkJoinPool::~ForkJoinPool() {
+        stop_.store(true, std::memory_order_release);
+        idle_.notify();
+        for (auto &t : workers_) {
+            t.join();
+        }
+    }
+
+    // Scan the other deques, starting next to self so thieves spread over victims
+    inline ForkJoinPool::Job *ForkJoinPool::steal_from_others(size_t self) noexcept {
+        const size_t n = deques_.size();
+        for (size_t k = 1; k < n; k++) {
+            if (auto job = deques_[(self + k) % n]->steal()) {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    inline bool ForkJoinPool::has_work() const noexcept {
+        for (const auto &d : deques_) {
+            if (!d->empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void ForkJoinPool::worker_main(size_t index) {
+        current() = Slot{this, index};
+        while (!stop_.load(std::memory_order_acquire)) {
+            // A worker's own deque only holds jobs forked by jobs it is running, so it is empty here
+            if (Job *job = steal_from_others(index)) {
+                job->execute(job);
+                continue;
+            }
+            idle_.wait([&] { return stop_.load(std::memory_order_acquire) || has_work(); },
+                       std::chrono::steady_clock::now() + std::chrono::milliseconds(10));
+        }
+        current() = Slot{};
+    }
+
+    // Wait for a forked job: run it inline if it is still ours, otherwise help until the thief is done
+    inline void ForkJoinPool::join(size_t self, Job &job) {
+        if (auto top = deques_[self]->pop()) {
+            if (*top == &job) {
+                job.execute(&job);
+                return;
+            }
+            // Ours was stolen and this belongs to an enclosing frame: leave it for that frame
+            deques_[self]->push(*top);
+        }
+        while (!job.done.load(std::memory_order_acquire)) {
+            if (Job *other = steal_from_others(self)) {
+                other->execute(other);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template <typename A, typename B> void ForkJoinPool::invoke(A &&a, B &&b) {
+        Slot &slot = current();
+        if (slot.pool == this) {
+            invoke_in_slot(slot.index, a, b);
+            return;
+        }
+
+        // Outside the pool: borrow the caller slot for the whole call tree
+        std::lock_guard<std::mutex> lock(caller_mutex_);
+        Slot saved = slot;
+        slot = Slot{this, 0};
+        try {
+            invoke_in_slot(0, a, b);
+        } catch (...) {
+            current() = saved;
+            throw;
+        }
+        current() = saved;
+    }
+
+    template <typename A, typename B> void ForkJoinPool::invoke_in_slot(size_t self, A &a, B &b) {
+        StackJob<B> forked(b);
+        deques_[self]->push(&forked);
+        idle_.notify();
+
+        try {
+            a();
+        } catch (...) {
+            join(self, forked); // forked still points into this frame
+            throw;
+        }
+        join(self, forked);
+        if (forked.error) {
+            std::rethrow_exception(forked.error);
+        }
+    }
+
+    template <typename Task> void ForkJoinPool::for_range(size_t lo, size_t hi, Task const &task) {
+        if (hi - lo > 1) {
+            const size_t mid = lo + (hi - lo) / 2;
+            invoke([&] { for_range(lo, mid, task); }, [&] { for_range(mid, hi, task); });
+        } else if (hi > lo) {
+            task(lo);
+        }
+    }
+
+    template <typename Task> void ForkJoinPool::operator()(size_t n, Task const &task) {
+        for_range(0, n, task);
+    }
+
+} // namespace datapod
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -13,8 +16,12 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <datapod/core/next_power_of_2.hpp>
 #include <datapod/pods/adapters/error.hpp>
+#include <datapod/pods/adapters/optional.hpp>
 #include <datapod/pods/adapters/result.hpp>
+#include <datapod/pods/lockfree/ring_memory.hpp>
+#include <datapod/pods/lockfree/wait_event.hpp>
 #include <datapod/pods/sequential/string.hpp>
 #include <datapod/pods/sequential/vector.hpp>
 
@@ -23,18 +30,38 @@ namespace datapod {
     struct SPSC {};
     struct MPMC {};
     struct SPMC {};
+    struct Broadcast {}; // Single producer, every reader sees every item
+    struct MPSC {};      // Many producers, one consumer (ByteRing)
 
     template <typename Policy, typename T> class RingBuffer;
 
+    // A run of ring slots starting at position pos: contiguous up to the end of the buffer, then
+    // wrapping to its start
+    template <typename T> struct RingSpans {
+        std::span<T> first;
+        std::span<T> second;
+        uint64_t pos = 0;
+
+        size_t size() const noexcept { return first.size() + second.size(); }
+        bool empty() const noexcept { return first.empty() && second.empty(); }
+
+        // k slots starting at slot idx of a buffer with the given capacity
+        static RingSpans of(T *buffer, size_t capacity, size_t idx, size_t k, uint64_t pos) noexcept {
+            size_t head = k < capacity - idx ? k : capacity - idx;
+            return RingSpans{std::span<T>(buffer + idx, head), std::span<T>(buffer, k - head), pos};
+        }
+    };
+
     template <typename T> class RingBuffer<SPSC, T> {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable for RingBuffer");
 
       public:
         RingBuffer() noexcept
             : header_(nullptr), buffer_(nullptr), owns_memory_(false), is_shm_(false), shm_fd_(-1), shm_size_(0) {}
-        explicit RingBuffer(size_t capacity);
-        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity);
-        static Result<RingBuffer, Error> attach_shm(const String &name);
+        explicit RingBuffer(size_t capacity, const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity,
+                                                  const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> attach_shm(const String &name, const RingOptions &options = RingOptions{});
         ~RingBuffer();
 
         RingBuffer(RingBuffer &&other) noexcept;
@@ -50,6 +77,30 @@ namespace datapod {
         inline Result<T, Error> pop();
         inline Result<const T *, Error> peek() const;
 
+        // Same as push/pop without building an Error: false / nullopt when full / empty,
+        // for producers and consumers that poll
+        inline bool try_push(const T &item);
+        inline bool try_push(T &&item);
+        inline Optional<T> try_pop();
+
+        // Block until the operation succeeds or the timeout passes (then Error::timeout), sleeping
+        // on a futex in the header instead of spinning; works across processes on shm rings
+        inline Result<bool, Error> push_wait(const T &item, std::chrono::nanoseconds timeout);
+        inline Result<T, Error> pop_wait(std::chrono::nanoseconds timeout);
+
+        // Batches: move up to items.size() items with a single index publication
+        // Returns how many were moved (fewer when the ring fills up or runs empty)
+        inline size_t push_n(std::span<const T> items);
+        inline size_t pop_n(std::span<T> out);
+
+        // Zero-copy write: up to n free slots to fill in place, published by commit_write(k <= n)
+        inline RingSpans<T> reserve_write(size_t n);
+        inline void commit_write(size_t n);
+
+        // Zero-copy read: every item ready to read, released by consume(k <= size)
+        inline RingSpans<const T> read_view() const;
+        inline void consume(size_t n);
+
         inline bool empty() const noexcept;
         inline bool full() const noexcept;
         inline size_t size() const noexcept;
@@ -96,8 +147,12 @@ namespace datapod {
             uint64_t capacity;
             uint32_t magic;
             uint32_t version;
+            uint32_t blocking; // RingOptions::blocking at creation: push/pop wake sleepers
 
-            Header() : write_pos(0), read_pos(0), capacity(0), magic(0x53505343), version(1) {}
+            alignas(64) WaitEvent readable; // Items published, for consumers blocked in pop_wait
+            WaitEvent writable;             // Slots freed, for producers blocked in push_wait
+
+            Header() : write_pos(0), read_pos(0), capacity(0), magic(0x53505343), version(2), blocking(0) {}
         };
 
         Header *header_;
@@ -105,22 +160,92 @@ namespace datapod {
         bool owns_memory_;
         bool is_shm_;
         int shm_fd_;
-        size_t shm_size_;
+        size_t shm_size_; // Mapping length: the shm segment, or an in-process ring built with RingOptions
         String shm_name_;
 
         static inline size_t calculate_shm_size(size_t capacity) noexcept {
             return sizeof(Header) + capacity * sizeof(T);
         }
 
-        inline void init_header(size_t capacity) noexcept {
+        inline void init_header(size_t capacity, bool blocking) noexcept {
             header_->write_pos.store(0, std::memory_order_relaxed);
             header_->read_pos.store(0, std::memory_order_relaxed);
             header_->capacity = capacity;
             header_->magic = 0x53505343;
-            header_->version = 1;
+            header_->version = 2;
+            header_->blocking = blocking ? 1U : 0U;
+            header_->readable.reset();
+            header_->writable.reset();
+        }
+
+        inline bool verify_header() const noexcept { return header_->magic == 0x53505343 && header_->version == 2; }
+
+        // Only rings created with RingOptions::blocking can have push_wait/pop_wait sleepers to wake
+        inline void notify_readable() noexcept {
+            if (blocking_) {
+                header_->readable.notify();
+            }
+        }
+
+        inline void notify_writable() noexcept {
+            if (blocking_) {
+                header_->writable.notify();
+            }
+        }
+
+        // Local copies of the ring geometry, so the hot path neither reloads nor divides
+        inline void load_geometry() noexcept {
+            capacity_ = header_->capacity;
+            pow2_ = (capacity_ & (capacity_ - 1)) == 0;
+            blocking_ = header_->blocking != 0U;
+            cached_read_pos_ = header_->read_pos.load(std::memory_order_acquire);
+            cached_write_pos_ = header_->write_pos.load(std::memory_order_acquire);
+        }
+
+        inline size_t index(uint64_t pos) const noexcept { return pow2_ ? (pos & (capacity_ - 1)) : (pos % capacity_); }
+
+        // Room for one more item; rereads the consumer's position only when the cached one says full
+        inline bool has_room(uint64_t w) noexcept {
+            if (w - cached_read_pos_ < capacity_) {
+                return true;
+            }
+            cached_read_pos_ = header_->read_pos.load(std::memory_order_acquire);
+            return w - cached_read_pos_ < capacity_;
+        }
+
+        // An item at r; rereads the producer's position only when the cached one says empty
+        inline bool has_item(uint64_t r) const noexcept {
+            if (r < cached_write_pos_) {
+                return true;
+            }
+            cached_write_pos_ = header_->write_pos.load(std::memory_order_acquire);
+            return r < cached_write_pos_;
+        }
+
+        // Free slots from w on; rereads the consumer's position only when fewer than n look free
+        inline size_t free_slots(uint64_t w, size_t n) noexcept {
+            if (capacity_ - (w - cached_read_pos_) < n) {
+                cached_read_pos_ = header_->read_pos.load(std::memory_order_acquire);
+            }
+            return capacity_ - (w - cached_read_pos_);
+        }
+
+        // Items ready from r on; rereads the producer's position only when fewer than n look ready
+        inline size_t ready_items(uint64_t r, size_t n) const noexcept {
+            if (cached_write_pos_ - r < n) {
+                cached_write_pos_ = header_->write_pos.load(std::memory_order_acquire);
+            }
+            return cached_write_pos_ - r;
         }
 
-        inline bool verify_header() const noexcept { return header_->magic == 0x53505343 && header_->version == 1; }
+        uint64_t capacity_ = 0;
+        bool pow2_ = false;
+        bool blocking_ = false;
+
+        // Each side's stale view of the other side's position, on its own cache line. A stale
+        // value only ever makes the ring look fuller (producer) or emptier (consumer) than it is.
+        alignas(64) uint64_t cached_read_pos_ = 0;
+        alignas(64) mutable uint64_t cached_write_pos_ = 0;
     };
 
     // ============================================================================
@@ -128,12 +253,13 @@ namespace datapod {
     // ============================================================================
 
     template <typename T>
-    RingBuffer<SPSC, T>::RingBuffer(size_t capacity) : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
+    RingBuffer<SPSC, T>::RingBuffer(size_t capacity, const RingOptions &options)
+        : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
         if (capacity == 0)
             capacity = 1;
 
         size_t total_size = calculate_shm_size(capacity);
-        void *mem = std::aligned_alloc(64, total_size);
+        void *mem = ring_memory::allocate(total_size, options, shm_size_);
         if (!mem) {
             header_ = nullptr;
             buffer_ = nullptr;
@@ -142,11 +268,13 @@ namespace datapod {
 
         header_ = new (mem) Header();
         buffer_ = reinterpret_cast<T *>(static_cast<uint8_t *>(mem) + sizeof(Header));
-        init_header(capacity);
+        init_header(capacity, options.blocking);
+        load_geometry();
     }
 
     template <typename T>
-    Result<RingBuffer<SPSC, T>, Error> RingBuffer<SPSC, T>::create_shm(const String &name, size_t capacity) {
+    Result<RingBuffer<SPSC, T>, Error> RingBuffer<SPSC, T>::create_shm(const String &name, size_t capacity,
+                                                                       const RingOptions &options) {
         if (capacity == 0) {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Capacity must be > 0"));
         }
@@ -176,6 +304,7 @@ namespace datapod {
             shm_unlink(name.c_str());
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, true);
 
         RingBuffer ring;
         ring.header_ = new (addr) Header();
@@ -185,12 +314,14 @@ namespace datapod {
         ring.shm_fd_ = fd;
         ring.shm_size_ = total_size;
         ring.shm_name_ = name;
-        ring.init_header(capacity);
+        ring.init_header(capacity, options.blocking);
+        ring.load_geometry();
 
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
-    template <typename T> Result<RingBuffer<SPSC, T>, Error> RingBuffer<SPSC, T>::attach_shm(const String &name) {
+    template <typename T>
+    Result<RingBuffer<SPSC, T>, Error> RingBuffer<SPSC, T>::attach_shm(const String &name, const RingOptions &options) {
         if (name.empty() || name[0] != '/') {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
         }
@@ -207,11 +338,13 @@ namespace datapod {
         }
         size_t total_size = st.st_size;
 
-        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int flags = options.populate ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, flags, fd, 0);
         if (addr == MAP_FAILED) {
             close(fd);
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, false);
 
         RingBuffer ring;
         ring.header_ = static_cast<Header *>(addr);
@@ -228,6 +361,7 @@ namespace datapod {
             return Result<RingBuffer, Error>::err(
                 Error::invalid_argument("Invalid ring buffer header (magic mismatch)"));
         }
+        ring.load_geometry();
 
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
@@ -242,14 +376,17 @@ namespace datapod {
                 shm_unlink(shm_name_.c_str());
         } else {
             if (header_)
-                std::free(header_);
+                ring_memory::release(header_, shm_size_);
         }
     }
 
     template <typename T>
     RingBuffer<SPSC, T>::RingBuffer(RingBuffer &&other) noexcept
         : header_(other.header_), buffer_(other.buffer_), owns_memory_(other.owns_memory_), is_shm_(other.is_shm_),
-          shm_fd_(other.shm_fd_), shm_size_(other.shm_size_), shm_name_(std::move(other.shm_name_)) {
+          shm_fd_(other.shm_fd_), shm_size_(other.shm_size_), shm_name_(std::move(other.shm_name_)),
+          capacity_(other.capacity_), pow2_(other.pow2_), blocking_(other.blocking_),
+          cached_read_pos_(other.cached_read_pos_),
+          cached_write_pos_(other.cached_write_pos_) {
         other.header_ = nullptr;
         other.buffer_ = nullptr;
         other.shm_fd_ = -1;
@@ -267,6 +404,11 @@ namespace datapod {
             shm_fd_ = other.shm_fd_;
             shm_size_ = other.shm_size_;
             shm_name_ = std::move(other.shm_name_);
+            capacity_ = other.capacity_;
+            pow2_ = other.pow2_;
+            blocking_ = other.blocking_;
+            cached_read_pos_ = other.cached_read_pos_;
+            cached_write_pos_ = other.cached_write_pos_;
             other.header_ = nullptr;
             other.buffer_ = nullptr;
             other.shm_fd_ = -1;
@@ -276,29 +418,55 @@ namespace datapod {
         return *this;
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<SPSC, T>::push(const T &item) {
+    template <typename T> inline bool RingBuffer<SPSC, T>::try_push(const T &item) {
         uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
-        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-        if (w - r >= header_->capacity) {
-            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        if (!has_room(w)) {
+            return false;
         }
-        size_t idx = w % header_->capacity;
+        size_t idx = index(w);
         buffer_[idx] = item;
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
-        return Result<bool, Error>::ok(true);
+        notify_readable();
+        return true;
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<SPSC, T>::push(T &&item) {
+    template <typename T> inline bool RingBuffer<SPSC, T>::try_push(T &&item) {
         uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
-        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-        if (w - r >= header_->capacity) {
-            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        if (!has_room(w)) {
+            return false;
         }
-        size_t idx = w % header_->capacity;
+        size_t idx = index(w);
         buffer_[idx] = std::move(item);
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
+        return true;
+    }
+
+    template <typename T> inline Optional<T> RingBuffer<SPSC, T>::try_pop() {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        if (!has_item(r)) {
+            return nullopt;
+        }
+        size_t idx = index(r);
+        Optional<T> item{buffer_[idx]};
+        header_->read_pos.store(r + 1, std::memory_order_release);
+        notify_writable();
+        return item;
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<SPSC, T>::push(const T &item) {
+        if (!try_push(item)) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<SPSC, T>::push(T &&item) {
+        if (!try_push(std::move(item))) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
         return Result<bool, Error>::ok(true);
     }
 
@@ -306,39 +474,86 @@ namespace datapod {
     template <typename... Args>
     inline Result<bool, Error> RingBuffer<SPSC, T>::emplace(Args &&...args) {
         uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
-        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-        if (w - r >= header_->capacity) {
+        if (!has_room(w)) {
             return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
         }
-        size_t idx = w % header_->capacity;
+        size_t idx = index(w);
         new (&buffer_[idx]) T(std::forward<Args>(args)...);
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
         return Result<bool, Error>::ok(true);
     }
 
     template <typename T> inline Result<T, Error> RingBuffer<SPSC, T>::pop() {
-        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
-        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-        if (w == r) {
+        auto item = try_pop();
+        if (!item.has_value()) {
             return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
         }
-        size_t idx = r % header_->capacity;
-        T item = buffer_[idx];
-        header_->read_pos.store(r + 1, std::memory_order_release);
-        return Result<T, Error>::ok(std::move(item));
+        return Result<T, Error>::ok(std::move(*item));
     }
 
     template <typename T> inline Result<const T *, Error> RingBuffer<SPSC, T>::peek() const {
         uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
-        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-        if (w == r) {
+        if (!has_item(r)) {
             return Result<const T *, Error>::err(Error::timeout("Ring buffer empty"));
         }
-        size_t idx = r % header_->capacity;
+        size_t idx = index(r);
         return Result<const T *, Error>::ok(&buffer_[idx]);
     }
 
+    template <typename T> inline size_t RingBuffer<SPSC, T>::push_n(std::span<const T> items) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        size_t free = free_slots(w, items.size());
+        auto dst = RingSpans<T>::of(buffer_, capacity_, index(w), items.size() < free ? items.size() : free, w);
+        std::copy(items.begin(), items.begin() + dst.first.size(), dst.first.begin());
+        std::copy(items.begin() + dst.first.size(), items.begin() + dst.size(), dst.second.begin());
+        if (!dst.empty()) {
+            std::atomic_thread_fence(std::memory_order_release);
+            header_->write_pos.store(w + dst.size(), std::memory_order_release);
+            notify_readable();
+        }
+        return dst.size();
+    }
+
+    template <typename T> inline size_t RingBuffer<SPSC, T>::pop_n(std::span<T> out) {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        size_t ready = ready_items(r, out.size());
+        auto src = RingSpans<T>::of(buffer_, capacity_, index(r), out.size() < ready ? out.size() : ready, r);
+        std::copy(src.first.begin(), src.first.end(), out.begin());
+        std::copy(src.second.begin(), src.second.end(), out.begin() + src.first.size());
+        if (!src.empty()) {
+            header_->read_pos.store(r + src.size(), std::memory_order_release);
+            notify_writable();
+        }
+        return src.size();
+    }
+
+    template <typename T> inline RingSpans<T> RingBuffer<SPSC, T>::reserve_write(size_t n) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        size_t free = free_slots(w, n);
+        return RingSpans<T>::of(buffer_, capacity_, index(w), n < free ? n : free, w);
+    }
+
+    template <typename T> inline void RingBuffer<SPSC, T>::commit_write(size_t n) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->write_pos.store(w + n, std::memory_order_release);
+        notify_readable();
+    }
+
+    template <typename T> inline RingSpans<const T> RingBuffer<SPSC, T>::read_view() const {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        size_t ready = ready_items(r, capacity_);
+        return RingSpans<const T>::of(buffer_, capacity_, index(r), ready, r);
+    }
+
+    template <typename T> inline void RingBuffer<SPSC, T>::consume(size_t n) {
+        uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
+        header_->read_pos.store(r + n, std::memory_order_release);
+        notify_writable();
+    }
+
     template <typename T> inline bool RingBuffer<SPSC, T>::empty() const noexcept {
         uint64_t r = header_->read_pos.load(std::memory_order_relaxed);
         uint64_t w = header_->write_pos.load(std::memory_order_acquire);
@@ -415,13 +630,45 @@ namespace datapod {
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
+    template <typename T>
+    inline Result<bool, Error> RingBuffer<SPSC, T>::push_wait(const T &item, std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<bool, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!try_push(item)) {
+            if (!header_->writable.wait([this] { return !full(); }, deadline)) {
+                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            }
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<T, Error> RingBuffer<SPSC, T>::pop_wait(std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<T, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto item = try_pop();
+            if (item.has_value()) {
+                return Result<T, Error>::ok(std::move(*item));
+            }
+            if (!header_->readable.wait([this] { return !empty(); }, deadline)) {
+                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+            }
+        }
+    }
+
     template <typename T> inline Vector<T> RingBuffer<SPSC, T>::drain() {
         Vector<T> result;
         while (true) {
-            auto item = pop();
-            if (!item.is_ok())
+            auto item = try_pop();
+            if (!item.has_value())
                 break;
-            result.push_back(std::move(item.value()));
+            result.push_back(std::move(*item));
         }
         return result;
     }
@@ -429,6 +676,13 @@ namespace datapod {
     // ============================================================================
     // MPMC (Multiple Producer Multiple Consumer) Implementation
     // ============================================================================
+    //
+    // Bounded queue with a sequence number per slot (Vyukov). A producer claims a position with
+    // one CAS on write_pos, writes the slot and then publishes it by bumping the slot's sequence;
+    // a consumer only takes a slot once that sequence says the write has finished. Threads
+    // contend on the position counters only while claiming, and then on distinct slots.
+    // The capacity is rounded up to a power of two (at least 2) so positions map to slots with a
+    // mask.
 
     template <typename T> class RingBuffer<MPMC, T> {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable for RingBuffer");
@@ -436,9 +690,10 @@ namespace datapod {
       public:
         RingBuffer() noexcept
             : header_(nullptr), buffer_(nullptr), owns_memory_(false), is_shm_(false), shm_fd_(-1), shm_size_(0) {}
-        explicit RingBuffer(size_t capacity);
-        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity);
-        static Result<RingBuffer, Error> attach_shm(const String &name);
+        explicit RingBuffer(size_t capacity, const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity,
+                                                  const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> attach_shm(const String &name, const RingOptions &options = RingOptions{});
         ~RingBuffer();
 
         RingBuffer(RingBuffer &&other) noexcept;
@@ -454,6 +709,24 @@ namespace datapod {
         inline Result<T, Error> pop();
         inline Result<const T *, Error> peek() const;
 
+        // Same as push/pop without building an Error: false / nullopt when full / empty,
+        // for producers and consumers that poll
+        inline bool try_push(const T &item);
+        inline bool try_push(T &&item);
+        inline Optional<T> try_pop();
+
+        // Block until the operation succeeds or the timeout passes (then Error::timeout), sleeping
+        // on a futex in the header instead of spinning; works across processes on shm rings
+        inline Result<bool, Error> push_wait(const T &item, std::chrono::nanoseconds timeout);
+        inline Result<T, Error> pop_wait(std::chrono::nanoseconds timeout);
+
+        // Batches: move up to items.size() items with a single index publication
+        // Returns how many were moved (fewer when the ring fills up or runs empty)
+        inline size_t push_n(std::span<const T> items);
+        inline size_t pop_n(std::span<T> out);
+        // (Slots interleave their sequence numbers with the values, so there are no
+        // contiguous spans to hand out for zero-copy access as on SPSC and SPMC)
+
         inline bool empty() const noexcept;
         inline bool full() const noexcept;
         inline size_t size() const noexcept;
@@ -490,6 +763,7 @@ namespace datapod {
         inline Vector<T> drain();
 
       private:
+        // Version 2: per-slot sequence numbers, power-of-two capacity
         struct alignas(64) Header {
             std::atomic<uint64_t> write_pos;
             uint8_t padding1[64 - sizeof(std::atomic<uint64_t>)];
@@ -498,33 +772,73 @@ namespace datapod {
             uint8_t padding2[64 - sizeof(std::atomic<uint64_t>)];
 
             uint64_t capacity;
+            uint64_t mask;
             uint32_t magic;
             uint32_t version;
+            uint32_t blocking; // RingOptions::blocking at creation: push/pop wake sleepers
+
+            alignas(64) WaitEvent readable; // Items published, for consumers blocked in pop_wait
+            WaitEvent writable;             // Slots freed, for producers blocked in push_wait
+
+            Header() : write_pos(0), read_pos(0), capacity(0), mask(0), magic(0x4D504D43), version(3), blocking(0) {}
+        };
 
-            Header() : write_pos(0), read_pos(0), capacity(0), magic(0x4D504D43), version(1) {}
+        // seq == pos: free for the producer claiming pos
+        // seq == pos + 1: holds the item for the consumer claiming pos
+        struct Slot {
+            std::atomic<uint64_t> seq;
+            T value;
         };
 
         Header *header_;
-        T *buffer_;
+        Slot *buffer_;
         bool owns_memory_;
         bool is_shm_;
         int shm_fd_;
-        size_t shm_size_;
+        size_t shm_size_; // Mapping length: the shm segment, or an in-process ring built with RingOptions
         String shm_name_;
 
         static inline size_t calculate_shm_size(size_t capacity) noexcept {
-            return sizeof(Header) + capacity * sizeof(T);
+            return sizeof(Header) + capacity * sizeof(Slot);
+        }
+
+        // At least two slots: with one, a free slot and a published one carry the same sequence
+        static inline size_t round_capacity(size_t capacity) noexcept {
+            return capacity <= 2 ? 2 : next_power_of_two(capacity);
         }
 
-        inline void init_header(size_t capacity) noexcept {
+        inline void init_header(size_t capacity, bool blocking) noexcept {
             header_->write_pos.store(0, std::memory_order_relaxed);
             header_->read_pos.store(0, std::memory_order_relaxed);
             header_->capacity = capacity;
+            header_->mask = capacity - 1;
             header_->magic = 0x4D504D43;
-            header_->version = 1;
+            header_->version = 3;
+            header_->blocking = blocking ? 1U : 0U;
+            header_->readable.reset();
+            header_->writable.reset();
+            for (size_t i = 0; i < capacity; ++i) {
+                new (&buffer_[i].seq) std::atomic<uint64_t>(i);
+            }
+        }
+
+        inline bool verify_header() const noexcept { return header_->magic == 0x4D504D43 && header_->version == 3; }
+
+        // Only rings created with RingOptions::blocking can have push_wait/pop_wait sleepers to wake
+        inline void notify_readable() noexcept {
+            if (header_->blocking != 0U) {
+                header_->readable.notify();
+            }
+        }
+
+        inline void notify_writable() noexcept {
+            if (header_->blocking != 0U) {
+                header_->writable.notify();
+            }
         }
 
-        inline bool verify_header() const noexcept { return header_->magic == 0x4D504D43 && header_->version == 1; }
+        inline Slot *claim_write(uint64_t &pos) noexcept;
+        inline Slot *claim_read(uint64_t &pos) noexcept;
     };
 
     // ============================================================================
@@ -537,9 +851,10 @@ namespace datapod {
       public:
         RingBuffer() noexcept
             : header_(nullptr), buffer_(nullptr), owns_memory_(false), is_shm_(false), shm_fd_(-1), shm_size_(0) {}
-        explicit RingBuffer(size_t capacity);
-        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity);
-        static Result<RingBuffer, Error> attach_shm(const String &name);
+        explicit RingBuffer(size_t capacity, const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity,
+                                                  const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> attach_shm(const String &name, const RingOptions &options = RingOptions{});
         ~RingBuffer();
 
         RingBuffer(RingBuffer &&other) noexcept;
@@ -555,6 +870,31 @@ namespace datapod {
         inline Result<T, Error> pop();
         inline Result<const T *, Error> peek() const;
 
+        // Same as push/pop without building an Error: false / nullopt when full / empty,
+        // for producers and consumers that poll
+        inline bool try_push(const T &item);
+        inline bool try_push(T &&item);
+        inline Optional<T> try_pop();
+
+        // Block until the operation succeeds or the timeout passes (then Error::timeout), sleeping
+        // on a futex in the header instead of spinning; works across processes on shm rings
+        inline Result<bool, Error> push_wait(const T &item, std::chrono::nanoseconds timeout);
+        inline Result<T, Error> pop_wait(std::chrono::nanoseconds timeout);
+
+        // Batches: move up to items.size() items with a single index publication
+        // Returns how many were moved (fewer when the ring fills up or runs empty)
+        inline size_t push_n(std::span<const T> items);
+        inline size_t pop_n(std::span<T> out);
+
+        // Zero-copy write: up to n free slots to fill in place, published by commit_write(k <= n)
+        inline RingSpans<T> reserve_write(size_t n);
+        inline void commit_write(size_t n);
+
+        // Zero-copy read for competing consumers: read optimistically, then claim with consume()
+        // consume() fails if another consumer claimed first; whatever was read must be dropped.
+        inline RingSpans<const T> read_view() const;
+        inline bool consume(const RingSpans<const T> &view, size_t n);
+
         inline bool empty() const noexcept;
         inline bool full() const noexcept;
         inline size_t size() const noexcept;
@@ -601,8 +941,12 @@ namespace datapod {
             uint64_t capacity;
             uint32_t magic;
             uint32_t version;
+            uint32_t blocking; // RingOptions::blocking at creation: push/pop wake sleepers
 
-            Header() : write_pos(0), read_pos(0), capacity(0), magic(0x53504D43), version(1) {}
+            alignas(64) WaitEvent readable; // Items published, for consumers blocked in pop_wait
+            WaitEvent writable;             // Slots freed, for producers blocked in push_wait
+
+            Header() : write_pos(0), read_pos(0), capacity(0), magic(0x53504D43), version(2), blocking(0) {}
         };
 
         Header *header_;
@@ -610,22 +954,38 @@ namespace datapod {
         bool owns_memory_;
         bool is_shm_;
         int shm_fd_;
-        size_t shm_size_;
+        size_t shm_size_; // Mapping length: the shm segment, or an in-process ring built with RingOptions
         String shm_name_;
 
         static inline size_t calculate_shm_size(size_t capacity) noexcept {
             return sizeof(Header) + capacity * sizeof(T);
         }
 
-        inline void init_header(size_t capacity) noexcept {
+        inline void init_header(size_t capacity, bool blocking) noexcept {
             header_->write_pos.store(0, std::memory_order_relaxed);
             header_->read_pos.store(0, std::memory_order_relaxed);
             header_->capacity = capacity;
             header_->magic = 0x53504D43;
-            header_->version = 1;
+            header_->version = 2;
+            header_->blocking = blocking ? 1U : 0U;
+            header_->readable.reset();
+            header_->writable.reset();
         }
 
-        inline bool verify_header() const noexcept { return header_->magic == 0x53504D43 && header_->version == 1; }
+        inline bool verify_header() const noexcept { return header_->magic == 0x53504D43 && header_->version == 2; }
+
+        // Only rings created with RingOptions::blocking can have push_wait/pop_wait sleepers to wake
+        inline void notify_readable() noexcept {
+            if (header_->blocking != 0U) {
+                header_->readable.notify();
+            }
+        }
+
+        inline void notify_writable() noexcept {
+            if (header_->blocking != 0U) {
+                header_->writable.notify();
+            }
+        }
     };
 
     // ============================================================================
@@ -633,12 +993,12 @@ namespace datapod {
     // ============================================================================
 
     template <typename T>
-    RingBuffer<MPMC, T>::RingBuffer(size_t capacity) : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
-        if (capacity == 0)
-            capacity = 1;
+    RingBuffer<MPMC, T>::RingBuffer(size_t capacity, const RingOptions &options)
+        : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
+        capacity = round_capacity(capacity);
 
         size_t total_size = calculate_shm_size(capacity);
-        void *mem = std::aligned_alloc(64, total_size);
+        void *mem = ring_memory::allocate(total_size, options, shm_size_);
         if (!mem) {
             header_ = nullptr;
             buffer_ = nullptr;
@@ -646,12 +1006,13 @@ namespace datapod {
         }
 
         header_ = new (mem) Header();
-        buffer_ = reinterpret_cast<T *>(static_cast<uint8_t *>(mem) + sizeof(Header));
-        init_header(capacity);
+        buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(mem) + sizeof(Header));
+        init_header(capacity, options.blocking);
     }
 
     template <typename T>
-    Result<RingBuffer<MPMC, T>, Error> RingBuffer<MPMC, T>::create_shm(const String &name, size_t capacity) {
+    Result<RingBuffer<MPMC, T>, Error> RingBuffer<MPMC, T>::create_shm(const String &name, size_t capacity,
+                                                                       const RingOptions &options) {
         if (capacity == 0) {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Capacity must be > 0"));
         }
@@ -660,6 +1021,7 @@ namespace datapod {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
         }
 
+        capacity = round_capacity(capacity);
         size_t total_size = calculate_shm_size(capacity);
         int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
         if (fd < 0) {
@@ -681,21 +1043,23 @@ namespace datapod {
             shm_unlink(name.c_str());
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, true);
 
         RingBuffer ring;
         ring.header_ = new (addr) Header();
-        ring.buffer_ = reinterpret_cast<T *>(static_cast<uint8_t *>(addr) + sizeof(Header));
+        ring.buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(addr) + sizeof(Header));
         ring.owns_memory_ = true;
         ring.is_shm_ = true;
         ring.shm_fd_ = fd;
         ring.shm_size_ = total_size;
         ring.shm_name_ = name;
-        ring.init_header(capacity);
+        ring.init_header(capacity, options.blocking);
 
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
-    template <typename T> Result<RingBuffer<MPMC, T>, Error> RingBuffer<MPMC, T>::attach_shm(const String &name) {
+    template <typename T>
+    Result<RingBuffer<MPMC, T>, Error> RingBuffer<MPMC, T>::attach_shm(const String &name, const RingOptions &options) {
         if (name.empty() || name[0] != '/') {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
         }
@@ -712,15 +1076,17 @@ namespace datapod {
         }
         size_t total_size = st.st_size;
 
-        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int flags = options.populate ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, flags, fd, 0);
         if (addr == MAP_FAILED) {
             close(fd);
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, false);
 
         RingBuffer ring;
         ring.header_ = static_cast<Header *>(addr);
-        ring.buffer_ = reinterpret_cast<T *>(static_cast<uint8_t *>(addr) + sizeof(Header));
+        ring.buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(addr) + sizeof(Header));
         ring.owns_memory_ = false;
         ring.is_shm_ = true;
         ring.shm_fd_ = fd;
@@ -747,7 +1113,7 @@ namespace datapod {
                 shm_unlink(shm_name_.c_str());
         } else {
             if (header_)
-                std::free(header_);
+                ring_memory::release(header_, shm_size_);
         }
     }
 
@@ -781,105 +1147,211 @@ namespace datapod {
         return *this;
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<MPMC, T>::push(const T &item) {
+    // Claim the slot for the next write position, nullptr when the ring is full
+    template <typename T>
+    inline typename RingBuffer<MPMC, T>::Slot *RingBuffer<MPMC, T>::claim_write(uint64_t &pos) noexcept {
+        pos = header_->write_pos.load(std::memory_order_relaxed);
         while (true) {
-            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-
-            if (w - r >= header_->capacity) {
-                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            Slot *slot = &buffer_[pos & header_->mask];
+            uint64_t seq = slot->seq.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(seq - pos);
+            if (diff == 0) {
+                if (header_->write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return slot;
+                }
+            } else if (diff < 0) {
+                return nullptr; // Still holds the item from one lap ago
+            } else {
+                pos = header_->write_pos.load(std::memory_order_relaxed);
             }
+        }
+    }
 
-            if (header_->write_pos.compare_exchange_weak(w, w + 1, std::memory_order_acq_rel,
-                                                         std::memory_order_acquire)) {
-                size_t idx = w % header_->capacity;
-                buffer_[idx] = item;
-                return Result<bool, Error>::ok(true);
+    // Claim the slot for the next read position, nullptr when nothing is published there yet
+    template <typename T>
+    inline typename RingBuffer<MPMC, T>::Slot *RingBuffer<MPMC, T>::claim_read(uint64_t &pos) noexcept {
+        pos = header_->read_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot *slot = &buffer_[pos & header_->mask];
+            uint64_t seq = slot->seq.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (header_->read_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return slot;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = header_->read_pos.load(std::memory_order_relaxed);
             }
         }
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<MPMC, T>::push(T &&item) {
-        while (true) {
-            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+    template <typename T> inline bool RingBuffer<MPMC, T>::try_push(const T &item) {
+        uint64_t pos;
+        Slot *slot = claim_write(pos);
+        if (!slot) {
+            return false;
+        }
+        slot->value = item;
+        slot->seq.store(pos + 1, std::memory_order_release);
+        notify_readable();
+        return true;
+    }
 
-            if (w - r >= header_->capacity) {
-                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
-            }
+    template <typename T> inline bool RingBuffer<MPMC, T>::try_push(T &&item) {
+        uint64_t pos;
+        Slot *slot = claim_write(pos);
+        if (!slot) {
+            return false;
+        }
+        slot->value = std::move(item);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        notify_readable();
+        return true;
+    }
 
-            if (header_->write_pos.compare_exchange_weak(w, w + 1, std::memory_order_acq_rel,
-                                                         std::memory_order_acquire)) {
-                size_t idx = w % header_->capacity;
-                buffer_[idx] = std::move(item);
-                return Result<bool, Error>::ok(true);
-            }
+    template <typename T> inline Optional<T> RingBuffer<MPMC, T>::try_pop() {
+        uint64_t pos;
+        Slot *slot = claim_read(pos);
+        if (!slot) {
+            return nullopt;
+        }
+        Optional<T> item{slot->value};
+        slot->seq.store(pos + header_->mask + 1, std::memory_order_release); // Free for the next lap
+        notify_writable();
+        return item;
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<MPMC, T>::push(const T &item) {
+        if (!try_push(item)) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<MPMC, T>::push(T &&item) {
+        if (!try_push(std::move(item))) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
         }
+        return Result<bool, Error>::ok(true);
     }
 
     template <typename T>
     template <typename... Args>
     inline Result<bool, Error> RingBuffer<MPMC, T>::emplace(Args &&...args) {
-        while (true) {
-            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        uint64_t pos;
+        Slot *slot = claim_write(pos);
+        if (!slot) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
+        new (&slot->value) T(std::forward<Args>(args)...);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        notify_readable();
+        return Result<bool, Error>::ok(true);
+    }
 
-            if (w - r >= header_->capacity) {
-                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
-            }
+    template <typename T> inline Result<T, Error> RingBuffer<MPMC, T>::pop() {
+        auto item = try_pop();
+        if (!item.has_value()) {
+            return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+        }
+        return Result<T, Error>::ok(std::move(*item));
+    }
 
-            if (header_->write_pos.compare_exchange_weak(w, w + 1, std::memory_order_acq_rel,
-                                                         std::memory_order_acquire)) {
-                size_t idx = w % header_->capacity;
-                new (&buffer_[idx]) T(std::forward<Args>(args)...);
-                return Result<bool, Error>::ok(true);
-            }
+    template <typename T> inline Result<const T *, Error> RingBuffer<MPMC, T>::peek() const {
+        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        const Slot &slot = buffer_[r & header_->mask];
+        if (slot.seq.load(std::memory_order_acquire) != r + 1) {
+            return Result<const T *, Error>::err(Error::timeout("Ring buffer empty"));
         }
+        return Result<const T *, Error>::ok(&slot.value);
     }
 
-    template <typename T> inline Result<T, Error> RingBuffer<MPMC, T>::pop() {
+    // Claim up to n consecutive free slots with one CAS on write_pos, then fill and publish them
+    template <typename T> inline size_t RingBuffer<MPMC, T>::push_n(std::span<const T> items) {
+        if (items.empty()) {
+            return 0;
+        }
+        const uint64_t mask = header_->mask;
+        uint64_t pos = header_->write_pos.load(std::memory_order_relaxed);
+        size_t k = 0;
         while (true) {
-            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-
-            if (w == r) {
-                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+            int64_t diff = static_cast<int64_t>(buffer_[pos & mask].seq.load(std::memory_order_acquire) - pos);
+            if (diff < 0) {
+                return 0; // Full
             }
-
-            if (header_->read_pos.compare_exchange_weak(r, r + 1, std::memory_order_acq_rel,
-                                                        std::memory_order_acquire)) {
-                size_t idx = r % header_->capacity;
-                T item = buffer_[idx];
-                return Result<T, Error>::ok(std::move(item));
+            if (diff > 0) {
+                pos = header_->write_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            k = 1;
+            while (k < items.size() && buffer_[(pos + k) & mask].seq.load(std::memory_order_acquire) == pos + k) {
+                ++k;
+            }
+            if (header_->write_pos.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                break;
             }
         }
+        for (size_t i = 0; i < k; ++i) {
+            Slot &slot = buffer_[(pos + i) & mask];
+            slot.value = items[i];
+            slot.seq.store(pos + i + 1, std::memory_order_release);
+        }
+        notify_readable();
+        return k;
     }
 
-    template <typename T> inline Result<const T *, Error> RingBuffer<MPMC, T>::peek() const {
-        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-        if (w == r) {
-            return Result<const T *, Error>::err(Error::timeout("Ring buffer empty"));
+    // Claim up to n consecutive published slots with one CAS on read_pos, then copy and free them
+    template <typename T> inline size_t RingBuffer<MPMC, T>::pop_n(std::span<T> out) {
+        if (out.empty()) {
+            return 0;
         }
-        size_t idx = r % header_->capacity;
-        return Result<const T *, Error>::ok(&buffer_[idx]);
+        const uint64_t mask = header_->mask;
+        uint64_t pos = header_->read_pos.load(std::memory_order_relaxed);
+        size_t k = 0;
+        while (true) {
+            int64_t diff = static_cast<int64_t>(buffer_[pos & mask].seq.load(std::memory_order_acquire) - (pos + 1));
+            if (diff < 0) {
+                return 0; // Empty
+            }
+            if (diff > 0) {
+                pos = header_->read_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            k = 1;
+            while (k < out.size() && buffer_[(pos + k) & mask].seq.load(std::memory_order_acquire) == pos + k + 1) {
+                ++k;
+            }
+            if (header_->read_pos.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < k; ++i) {
+            Slot &slot = buffer_[(pos + i) & mask];
+            out[i] = slot.value;
+            slot.seq.store(pos + i + mask + 1, std::memory_order_release);
+        }
+        notify_writable();
+        return k;
     }
 
     template <typename T> inline bool RingBuffer<MPMC, T>::empty() const noexcept {
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
         uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-        return w == r;
+        return w <= r;
     }
 
     template <typename T> inline bool RingBuffer<MPMC, T>::full() const noexcept {
-        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-        return (w - r) >= header_->capacity;
+        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+        return w >= r && (w - r) >= header_->capacity;
     }
 
     template <typename T> inline size_t RingBuffer<MPMC, T>::size() const noexcept {
-        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+        // read_pos never passes write_pos, so loading it first keeps the difference non-negative
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
         return w - r;
     }
 
@@ -912,8 +1384,7 @@ namespace datapod {
         snap.data.reserve(count);
 
         for (uint64_t pos = r; pos < w; pos++) {
-            size_t idx = pos % header_->capacity;
-            snap.data.push_back(buffer_[idx]);
+            snap.data.push_back(buffer_[pos & header_->mask].value);
         }
 
         return snap;
@@ -941,13 +1412,45 @@ namespace datapod {
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
+    template <typename T>
+    inline Result<bool, Error> RingBuffer<MPMC, T>::push_wait(const T &item, std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<bool, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!try_push(item)) {
+            if (!header_->writable.wait([this] { return !full(); }, deadline)) {
+                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            }
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<T, Error> RingBuffer<MPMC, T>::pop_wait(std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<T, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto item = try_pop();
+            if (item.has_value()) {
+                return Result<T, Error>::ok(std::move(*item));
+            }
+            if (!header_->readable.wait([this] { return !empty(); }, deadline)) {
+                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+            }
+        }
+    }
+
     template <typename T> inline Vector<T> RingBuffer<MPMC, T>::drain() {
         Vector<T> result;
         while (true) {
-            auto item = pop();
-            if (!item.is_ok())
+            auto item = try_pop();
+            if (!item.has_value())
                 break;
-            result.push_back(std::move(item.value()));
+            result.push_back(std::move(*item));
         }
         return result;
     }
@@ -957,12 +1460,13 @@ namespace datapod {
     // ============================================================================
 
     template <typename T>
-    RingBuffer<SPMC, T>::RingBuffer(size_t capacity) : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
+    RingBuffer<SPMC, T>::RingBuffer(size_t capacity, const RingOptions &options)
+        : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
         if (capacity == 0)
             capacity = 1;
 
         size_t total_size = calculate_shm_size(capacity);
-        void *mem = std::aligned_alloc(64, total_size);
+        void *mem = ring_memory::allocate(total_size, options, shm_size_);
         if (!mem) {
             header_ = nullptr;
             buffer_ = nullptr;
@@ -971,11 +1475,12 @@ namespace datapod {
 
         header_ = new (mem) Header();
         buffer_ = reinterpret_cast<T *>(static_cast<uint8_t *>(mem) + sizeof(Header));
-        init_header(capacity);
+        init_header(capacity, options.blocking);
     }
 
     template <typename T>
-    Result<RingBuffer<SPMC, T>, Error> RingBuffer<SPMC, T>::create_shm(const String &name, size_t capacity) {
+    Result<RingBuffer<SPMC, T>, Error> RingBuffer<SPMC, T>::create_shm(const String &name, size_t capacity,
+                                                                       const RingOptions &options) {
         if (capacity == 0) {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Capacity must be > 0"));
         }
@@ -1005,6 +1510,7 @@ namespace datapod {
             shm_unlink(name.c_str());
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, true);
 
         RingBuffer ring;
         ring.header_ = new (addr) Header();
@@ -1014,12 +1520,13 @@ namespace datapod {
         ring.shm_fd_ = fd;
         ring.shm_size_ = total_size;
         ring.shm_name_ = name;
-        ring.init_header(capacity);
+        ring.init_header(capacity, options.blocking);
 
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
-    template <typename T> Result<RingBuffer<SPMC, T>, Error> RingBuffer<SPMC, T>::attach_shm(const String &name) {
+    template <typename T>
+    Result<RingBuffer<SPMC, T>, Error> RingBuffer<SPMC, T>::attach_shm(const String &name, const RingOptions &options) {
         if (name.empty() || name[0] != '/') {
             return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
         }
@@ -1036,11 +1543,13 @@ namespace datapod {
         }
         size_t total_size = st.st_size;
 
-        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int flags = options.populate ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, flags, fd, 0);
         if (addr == MAP_FAILED) {
             close(fd);
             return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
         }
+        ring_memory::prepare(addr, total_size, options, false);
 
         RingBuffer ring;
         ring.header_ = static_cast<Header *>(addr);
@@ -1071,7 +1580,7 @@ namespace datapod {
                 shm_unlink(shm_name_.c_str());
         } else {
             if (header_)
-                std::free(header_);
+                ring_memory::release(header_, shm_size_);
         }
     }
 
@@ -1105,29 +1614,64 @@ namespace datapod {
         return *this;
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<SPMC, T>::push(const T &item) {
+    template <typename T> inline bool RingBuffer<SPMC, T>::try_push(const T &item) {
         uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
         if (w - r >= header_->capacity) {
-            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            return false;
         }
         size_t idx = w % header_->capacity;
         buffer_[idx] = item;
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
-        return Result<bool, Error>::ok(true);
+        notify_readable();
+        return true;
     }
 
-    template <typename T> inline Result<bool, Error> RingBuffer<SPMC, T>::push(T &&item) {
+    template <typename T> inline bool RingBuffer<SPMC, T>::try_push(T &&item) {
         uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
         if (w - r >= header_->capacity) {
-            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            return false;
         }
         size_t idx = w % header_->capacity;
         buffer_[idx] = std::move(item);
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
+        return true;
+    }
+
+    template <typename T> inline Optional<T> RingBuffer<SPMC, T>::try_pop() {
+        while (true) {
+            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+
+            if (w == r) {
+                return nullopt;
+            }
+
+            // Copy before claiming: once read_pos moves on, the producer may reuse the slot
+            T item = buffer_[r % header_->capacity];
+            if (header_->read_pos.compare_exchange_weak(r, r + 1, std::memory_order_acq_rel,
+                                                        std::memory_order_acquire)) {
+                notify_writable();
+                return Optional<T>{std::move(item)};
+            }
+        }
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<SPMC, T>::push(const T &item) {
+        if (!try_push(item)) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<SPMC, T>::push(T &&item) {
+        if (!try_push(std::move(item))) {
+            return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+        }
         return Result<bool, Error>::ok(true);
     }
 
@@ -1143,25 +1687,16 @@ namespace datapod {
         new (&buffer_[idx]) T(std::forward<Args>(args)...);
         std::atomic_thread_fence(std::memory_order_release);
         header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
         return Result<bool, Error>::ok(true);
     }
 
     template <typename T> inline Result<T, Error> RingBuffer<SPMC, T>::pop() {
-        while (true) {
-            uint64_t r = header_->read_pos.load(std::memory_order_acquire);
-            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
-
-            if (w == r) {
-                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
-            }
-
-            if (header_->read_pos.compare_exchange_weak(r, r + 1, std::memory_order_acq_rel,
-                                                        std::memory_order_acquire)) {
-                size_t idx = r % header_->capacity;
-                T item = buffer_[idx];
-                return Result<T, Error>::ok(std::move(item));
-            }
+        auto item = try_pop();
+        if (!item.has_value()) {
+            return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
         }
+        return Result<T, Error>::ok(std::move(*item));
     }
 
     template <typename T> inline Result<const T *, Error> RingBuffer<SPMC, T>::peek() const {
@@ -1174,6 +1709,67 @@ namespace datapod {
         return Result<const T *, Error>::ok(&buffer_[idx]);
     }
 
+    template <typename T> inline size_t RingBuffer<SPMC, T>::push_n(std::span<const T> items) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        auto dst = reserve_write(items.size());
+        std::copy(items.begin(), items.begin() + dst.first.size(), dst.first.begin());
+        std::copy(items.begin() + dst.first.size(), items.begin() + dst.size(), dst.second.begin());
+        if (!dst.empty()) {
+            std::atomic_thread_fence(std::memory_order_release);
+            header_->write_pos.store(w + dst.size(), std::memory_order_release);
+            notify_readable();
+        }
+        return dst.size();
+    }
+
+    // Copy what is ready, then claim it with one CAS; a lost race discards the copy and retries
+    template <typename T> inline size_t RingBuffer<SPMC, T>::pop_n(std::span<T> out) {
+        while (true) {
+            auto src = read_view();
+            size_t k = out.size() < src.size() ? out.size() : src.size();
+            if (k == 0) {
+                return 0;
+            }
+            size_t head = k < src.first.size() ? k : src.first.size();
+            std::copy(src.first.begin(), src.first.begin() + head, out.begin());
+            std::copy(src.second.begin(), src.second.begin() + (k - head), out.begin() + head);
+            if (consume(src, k)) {
+                return k;
+            }
+        }
+    }
+
+    template <typename T> inline RingSpans<T> RingBuffer<SPMC, T>::reserve_write(size_t n) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        size_t free = header_->capacity - (w - r);
+        return RingSpans<T>::of(buffer_, header_->capacity, w % header_->capacity, n < free ? n : free, w);
+    }
+
+    template <typename T> inline void RingBuffer<SPMC, T>::commit_write(size_t n) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->write_pos.store(w + n, std::memory_order_release);
+        notify_readable();
+    }
+
+    template <typename T> inline RingSpans<const T> RingBuffer<SPMC, T>::read_view() const {
+        uint64_t r = header_->read_pos.load(std::memory_order_acquire);
+        uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+        size_t k = w - r < header_->capacity ? w - r : header_->capacity; // r may already be stale
+        return RingSpans<const T>::of(buffer_, header_->capacity, r % header_->capacity, k, r);
+    }
+
+    template <typename T> inline bool RingBuffer<SPMC, T>::consume(const RingSpans<const T> &view, size_t n) {
+        uint64_t r = view.pos;
+        if (!header_->read_pos.compare_exchange_strong(r, r + n, std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+            return false;
+        }
+        notify_writable();
+        return true;
+    }
+
     template <typename T> inline bool RingBuffer<SPMC, T>::empty() const noexcept {
         uint64_t r = header_->read_pos.load(std::memory_order_acquire);
         uint64_t w = header_->write_pos.load(std::memory_order_acquire);
@@ -1250,17 +1846,490 @@ namespace datapod {
         return Result<RingBuffer, Error>::ok(std::move(ring));
     }
 
+    template <typename T>
+    inline Result<bool, Error> RingBuffer<SPMC, T>::push_wait(const T &item, std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<bool, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!try_push(item)) {
+            if (!header_->writable.wait([this] { return !full(); }, deadline)) {
+                return Result<bool, Error>::err(Error::timeout("Ring buffer full"));
+            }
+        }
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline Result<T, Error> RingBuffer<SPMC, T>::pop_wait(std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<T, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto item = try_pop();
+            if (item.has_value()) {
+                return Result<T, Error>::ok(std::move(*item));
+            }
+            if (!header_->readable.wait([this] { return !empty(); }, deadline)) {
+                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+            }
+        }
+    }
+
     template <typename T> inline Vector<T> RingBuffer<SPMC, T>::drain() {
         Vector<T> result;
         while (true) {
-            auto item = pop();
-            if (!item.is_ok())
+            auto item = try_pop();
+            if (!item.has_value())
                 break;
-            result.push_back(std::move(item.value()));
+            result.push_back(std::move(*item));
         }
         return result;
     }
 
+    // ============================================================================
+    // Broadcast (Single Producer, every reader sees every item) Implementation
+    // ============================================================================
+    //
+    // Pub/sub fan-out: the writer never waits for anyone and overwrites the oldest item when the
+    // ring is full, and each reader keeps its own cursor outside the ring, so N subscribers (in
+    // this or other processes via attach_shm) cost the writer nothing per reader.
+    //
+    // Each slot carries a seqlock sequence: 2p + 1 while position p is being written, 2p + 2 once
+    // it holds p. A reader copies (or looks at) the slot between two reads of that sequence; if
+    // the sequence moved, the writer lapped the reader and the item is counted as lost. A reader
+    // that falls more than capacity() behind skips ahead to the oldest item still held.
+    // The capacity is rounded up to a power of two.
+
+    template <typename T> class RingBuffer<Broadcast, T> {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable for RingBuffer");
+
+        struct Header;
+        struct Slot;
+
+      public:
+        RingBuffer() noexcept
+            : header_(nullptr), buffer_(nullptr), owns_memory_(false), is_shm_(false), shm_fd_(-1), shm_size_(0) {}
+        explicit RingBuffer(size_t capacity, const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> create_shm(const String &name, size_t capacity,
+                                                  const RingOptions &options = RingOptions{});
+        static Result<RingBuffer, Error> attach_shm(const String &name, const RingOptions &options = RingOptions{});
+        ~RingBuffer();
+
+        RingBuffer(RingBuffer &&other) noexcept;
+        RingBuffer &operator=(RingBuffer &&other) noexcept;
+        RingBuffer(const RingBuffer &) = delete;
+        RingBuffer &operator=(const RingBuffer &) = delete;
+
+        // Writer side (one writer): never blocks, never fails, overwrites the oldest item
+        inline Result<bool, Error> push(const T &item);
+        inline size_t push_n(std::span<const T> items);
+
+        // Zero-copy write: fill the next slot in place, then publish it
+        inline T *reserve_write() noexcept;
+        inline void commit_write() noexcept;
+
+        // A reader's cursor into the ring; readers never write to the ring
+        class Reader {
+          public:
+            inline Optional<T> try_pop();
+            inline Result<T, Error> pop();
+            inline Result<T, Error> pop_wait(std::chrono::nanoseconds timeout);
+
+            // Zero-copy read: the next item in place, then consume() checks that the writer did
+            // not overwrite it meanwhile. On false, whatever was read from it must be dropped.
+            inline const T *peek();
+            inline bool consume();
+
+            // Items published past the cursor (more than capacity() once the reader is lapped)
+            inline size_t available() const noexcept;
+            inline uint64_t position() const noexcept { return cursor_; }
+            // Items overwritten before this reader got to them
+            inline uint64_t lost() const noexcept { return lost_; }
+
+          private:
+            friend class RingBuffer;
+            Reader(Header *header, const Slot *buffer, uint64_t cursor) noexcept
+                : header_(header), buffer_(buffer), cursor_(cursor), lost_(0) {}
+
+            inline const Slot *next_slot() noexcept;
+
+            Header *header_;
+            const Slot *buffer_;
+            uint64_t cursor_;
+            uint64_t lost_;
+        };
+
+        // A reader that starts with the next item published
+        inline Reader reader() const noexcept;
+
+        inline uint64_t published() const noexcept;
+        inline size_t capacity() const noexcept;
+
+      private:
+        struct alignas(64) Header {
+            std::atomic<uint64_t> write_pos;
+            uint8_t padding1[64 - sizeof(std::atomic<uint64_t>)];
+
+            uint64_t capacity;
+            uint64_t mask;
+            uint32_t magic;
+            uint32_t version;
+            uint32_t blocking; // RingOptions::blocking at creation: push/pop wake sleepers
+
+            alignas(64) WaitEvent readable; // Items published, for readers blocked in pop_wait
+
+            Header() : write_pos(0), capacity(0), mask(0), magic(0x42434153), version(1), blocking(0) {}
+        };
+
+        struct Slot {
+            std::atomic<uint64_t> seq;
+            T value;
+        };
+
+        Header *header_;
+        Slot *buffer_;
+        bool owns_memory_;
+        bool is_shm_;
+        int shm_fd_;
+        size_t shm_size_; // Mapping length: the shm segment, or an in-process ring built with RingOptions
+        String shm_name_;
+
+        static inline size_t calculate_shm_size(size_t capacity) noexcept {
+            return sizeof(Header) + capacity * sizeof(Slot);
+        }
+
+        static inline size_t round_capacity(size_t capacity) noexcept {
+            return capacity <= 1 ? 1 : next_power_of_two(capacity);
+        }
+
+        inline void init_header(size_t capacity, bool blocking) noexcept {
+            header_->write_pos.store(0, std::memory_order_relaxed);
+            header_->capacity = capacity;
+            header_->mask = capacity - 1;
+            header_->magic = 0x42434153;
+            header_->version = 1;
+            header_->blocking = blocking ? 1U : 0U;
+            header_->readable.reset();
+            for (size_t i = 0; i < capacity; ++i) {
+                new (&buffer_[i].seq) std::atomic<uint64_t>(0); // Never written
+            }
+        }
+
+        inline bool verify_header() const noexcept { return header_->magic == 0x42434153 && header_->version == 1; }
+
+        // Only rings created with RingOptions::blocking can have push_wait/pop_wait sleepers to wake
+        inline void notify_readable() noexcept {
+            if (header_->blocking != 0U) {
+                header_->readable.notify();
+            }
+        }
+
+        inline void write_slot(uint64_t pos, const T &item) noexcept;
+    };
+
+    // ============================================================================
+    // BROADCAST IMPLEMENTATION
+    // ============================================================================
+
+    template <typename T>
+    RingBuffer<Broadcast, T>::RingBuffer(size_t capacity, const RingOptions &options)
+        : owns_memory_(true), is_shm_(false), shm_fd_(-1), shm_size_(0) {
+        capacity = round_capacity(capacity);
+
+        size_t total_size = calculate_shm_size(capacity);
+        void *mem = ring_memory::allocate(total_size, options, shm_size_);
+        if (!mem) {
+            header_ = nullptr;
+            buffer_ = nullptr;
+            return;
+        }
+
+        header_ = new (mem) Header();
+        buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(mem) + sizeof(Header));
+        init_header(capacity, options.blocking);
+    }
+
+    template <typename T>
+    Result<RingBuffer<Broadcast, T>, Error> RingBuffer<Broadcast, T>::create_shm(const String &name, size_t capacity,
+                                                                                 const RingOptions &options) {
+        if (capacity == 0) {
+            return Result<RingBuffer, Error>::err(Error::invalid_argument("Capacity must be > 0"));
+        }
+
+        if (name.empty() || name[0] != '/') {
+            return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
+        }
+
+        capacity = round_capacity(capacity);
+        size_t total_size = calculate_shm_size(capacity);
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+        if (fd < 0) {
+            if (errno == EEXIST) {
+                return Result<RingBuffer, Error>::err(Error::already_exists("Shared memory already exists"));
+            }
+            return Result<RingBuffer, Error>::err(Error::io_error("shm_open failed"));
+        }
+
+        if (ftruncate(fd, total_size) < 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return Result<RingBuffer, Error>::err(Error::io_error("ftruncate failed"));
+        }
+
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
+        }
+        ring_memory::prepare(addr, total_size, options, true);
+
+        RingBuffer ring;
+        ring.header_ = new (addr) Header();
+        ring.buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(addr) + sizeof(Header));
+        ring.owns_memory_ = true;
+        ring.is_shm_ = true;
+        ring.shm_fd_ = fd;
+        ring.shm_size_ = total_size;
+        ring.shm_name_ = name;
+        ring.init_header(capacity, options.blocking);
+
+        return Result<RingBuffer, Error>::ok(std::move(ring));
+    }
+
+    template <typename T>
+    Result<RingBuffer<Broadcast, T>, Error> RingBuffer<Broadcast, T>::attach_shm(const String &name,
+                                                                              const RingOptions &options) {
+        if (name.empty() || name[0] != '/') {
+            return Result<RingBuffer, Error>::err(Error::invalid_argument("Shared memory name must start with '/'"));
+        }
+
+        int fd = shm_open(name.c_str(), O_RDWR, 0666);
+        if (fd < 0) {
+            return Result<RingBuffer, Error>::err(Error::not_found("Shared memory not found"));
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) < 0) {
+            close(fd);
+            return Result<RingBuffer, Error>::err(Error::io_error("fstat failed"));
+        }
+        size_t total_size = st.st_size;
+
+        int flags = options.populate ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void *addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            return Result<RingBuffer, Error>::err(Error::io_error("mmap failed"));
+        }
+        ring_memory::prepare(addr, total_size, options, false);
+
+        RingBuffer ring;
+        ring.header_ = static_cast<Header *>(addr);
+        ring.buffer_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(addr) + sizeof(Header));
+        ring.owns_memory_ = false;
+        ring.is_shm_ = true;
+        ring.shm_fd_ = fd;
+        ring.shm_size_ = total_size;
+        ring.shm_name_ = name;
+
+        if (!ring.verify_header()) {
+            munmap(addr, total_size);
+            close(fd);
+            return Result<RingBuffer, Error>::err(
+                Error::invalid_argument("Invalid ring buffer header (magic mismatch)"));
+        }
+
+        return Result<RingBuffer, Error>::ok(std::move(ring));
+    }
+
+    template <typename T> RingBuffer<Broadcast, T>::~RingBuffer() {
+        if (is_shm_) {
+            if (header_)
+                munmap(header_, shm_size_);
+            if (shm_fd_ >= 0)
+                close(shm_fd_);
+            if (owns_memory_ && !shm_name_.empty())
+                shm_unlink(shm_name_.c_str());
+        } else {
+            if (header_)
+                ring_memory::release(header_, shm_size_);
+        }
+    }
+
+    template <typename T>
+    RingBuffer<Broadcast, T>::RingBuffer(RingBuffer &&other) noexcept
+        : header_(other.header_), buffer_(other.buffer_), owns_memory_(other.owns_memory_), is_shm_(other.is_shm_),
+          shm_fd_(other.shm_fd_), shm_size_(other.shm_size_), shm_name_(std::move(other.shm_name_)) {
+        other.header_ = nullptr;
+        other.buffer_ = nullptr;
+        other.shm_fd_ = -1;
+        other.owns_memory_ = false;
+        other.is_shm_ = false;
+    }
+
+    template <typename T>
+    RingBuffer<Broadcast, T> &RingBuffer<Broadcast, T>::operator=(RingBuffer &&other) noexcept {
+        if (this != &other) {
+            this->~RingBuffer();
+            header_ = other.header_;
+            buffer_ = other.buffer_;
+            owns_memory_ = other.owns_memory_;
+            is_shm_ = other.is_shm_;
+            shm_fd_ = other.shm_fd_;
+            shm_size_ = other.shm_size_;
+            shm_name_ = std::move(other.shm_name_);
+            other.header_ = nullptr;
+            other.buffer_ = nullptr;
+            other.shm_fd_ = -1;
+            other.owns_memory_ = false;
+            other.is_shm_ = false;
+        }
+        return *this;
+    }
+
+    // Odd sequence, then the value, then the even sequence that marks the slot as holding pos
+    template <typename T> inline void RingBuffer<Broadcast, T>::write_slot(uint64_t pos, const T &item) noexcept {
+        Slot &slot = buffer_[pos & header_->mask];
+        slot.seq.store(2 * pos + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = item;
+        slot.seq.store(2 * pos + 2, std::memory_order_release);
+    }
+
+    template <typename T> inline Result<bool, Error> RingBuffer<Broadcast, T>::push(const T &item) {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        write_slot(w, item);
+        header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
+        return Result<bool, Error>::ok(true);
+    }
+
+    template <typename T> inline size_t RingBuffer<Broadcast, T>::push_n(std::span<const T> items) {
+        if (items.empty()) {
+            return 0;
+        }
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < items.size(); ++i) {
+            write_slot(w + i, items[i]);
+        }
+        header_->write_pos.store(w + items.size(), std::memory_order_release);
+        notify_readable();
+        return items.size();
+    }
+
+    template <typename T> inline T *RingBuffer<Broadcast, T>::reserve_write() noexcept {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        Slot &slot = buffer_[w & header_->mask];
+        slot.seq.store(2 * w + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return &slot.value;
+    }
+
+    template <typename T> inline void RingBuffer<Broadcast, T>::commit_write() noexcept {
+        uint64_t w = header_->write_pos.load(std::memory_order_relaxed);
+        buffer_[w & header_->mask].seq.store(2 * w + 2, std::memory_order_release);
+        header_->write_pos.store(w + 1, std::memory_order_release);
+        notify_readable();
+    }
+
+    template <typename T>
+    inline typename RingBuffer<Broadcast, T>::Reader RingBuffer<Broadcast, T>::reader() const noexcept {
+        return Reader(header_, buffer_, header_->write_pos.load(std::memory_order_acquire));
+    }
+
+    template <typename T> inline uint64_t RingBuffer<Broadcast, T>::published() const noexcept {
+        return header_->write_pos.load(std::memory_order_acquire);
+    }
+
+    template <typename T> inline size_t RingBuffer<Broadcast, T>::capacity() const noexcept {
+        return header_->capacity;
+    }
+
+    // The slot holding the item at the cursor, skipping whatever the writer has already overwritten;
+    // nullptr when the reader has caught up
+    template <typename T>
+    inline const typename RingBuffer<Broadcast, T>::Slot *RingBuffer<Broadcast, T>::Reader::next_slot() noexcept {
+        while (true) {
+            uint64_t w = header_->write_pos.load(std::memory_order_acquire);
+            if (cursor_ >= w) {
+                return nullptr;
+            }
+            if (w - cursor_ > header_->capacity) {
+                lost_ += w - header_->capacity - cursor_;
+                cursor_ = w - header_->capacity;
+            }
+            const Slot *slot = &buffer_[cursor_ & header_->mask];
+            if (slot->seq.load(std::memory_order_acquire) == 2 * cursor_ + 2) {
+                return slot;
+            }
+            ++lost_; // Overwritten since write_pos was read
+            ++cursor_;
+        }
+    }
+
+    template <typename T> inline Optional<T> RingBuffer<Broadcast, T>::Reader::try_pop() {
+        while (true) {
+            const Slot *slot = next_slot();
+            if (!slot) {
+                return nullopt;
+            }
+            T item = slot->value;
+            if (consume()) {
+                return Optional<T>{item};
+            }
+        }
+    }
+
+    template <typename T> inline Result<T, Error> RingBuffer<Broadcast, T>::Reader::pop() {
+        auto item = try_pop();
+        if (!item.has_value()) {
+            return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+        }
+        return Result<T, Error>::ok(std::move(*item));
+    }
+
+    template <typename T>
+    inline Result<T, Error> RingBuffer<Broadcast, T>::Reader::pop_wait(std::chrono::nanoseconds timeout) {
+        if (header_->blocking == 0U) {
+            return Result<T, Error>::err(
+                Error::invalid_argument("Ring buffer not created with RingOptions::blocking"));
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto item = try_pop();
+            if (item.has_value()) {
+                return Result<T, Error>::ok(std::move(*item));
+            }
+            if (!header_->readable.wait([this] { return available() != 0; }, deadline)) {
+                return Result<T, Error>::err(Error::timeout("Ring buffer empty"));
+            }
+        }
+    }
+
+    template <typename T> inline const T *RingBuffer<Broadcast, T>::Reader::peek() {
+        const Slot *slot = next_slot();
+        return slot ? &slot->value : nullptr;
+    }
+
+    // Second half of the seqlock read: the slot must still hold the cursor's item
+    template <typename T> inline bool RingBuffer<Broadcast, T>::Reader::consume() {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        bool intact = buffer_[cursor_ & header_->mask].seq.load(std::memory_order_relaxed) == 2 * cursor_ + 2;
+        if (!intact) {
+            ++lost_;
+        }
+        ++cursor_;
+        return intact;
+    }
+
+    template <typename T> inline size_t RingBuffer<Broadcast, T>::Reader::available() const noexcept {
+        return header_->write_pos.load(std::memory_order_acquire) - cursor_;
+    }
+
     namespace ring_buffer {
         /// Placeholder for template/container type (no useful make() function)
         inline void unimplemented() {}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+namespace datapod {
+
+    // ============================================================================
+    // RingOptions - page size, pre-faulting and NUMA placement of ring memory
+    // ============================================================================
+    //
+    // Every option is a best-effort hint: when the kernel cannot honour it (no huge pages reserved,
+    // no NUMA, an old kernel) the ring still gets ordinary memory and works the same, just without
+    // the speed-up. Default options keep the plain aligned_alloc path for in-process rings.
+    //
+    // huge_pages: in-process rings try MAP_HUGETLB first, then fall back to transparent huge pages
+    //   (MADV_HUGEPAGE). POSIX shm lives on tmpfs, which has no hugetlb support, so shm rings only
+    //   get the madvise (effective when /sys/kernel/mm/transparent_hugepage/shmem_enabled allows it).
+    // populate: fault every page in at construction, so the first lap does not pay for page faults.
+    //   For shm, whoever faults a page first decides where it lives: populate in create_shm;
+    //   attach_shm with populate maps with MAP_POPULATE.
+    // numa_node: prefer memory on this node (MPOL_PREFERRED); pages are placed when first touched,
+    //   so combine with populate to place the whole ring up front.
+
+    struct RingOptions {
+        bool huge_pages = false;
+        bool populate = false;
+        int numa_node = -1; // -1: the calling thread's default policy
+        // Enable push_wait/pop_wait: every push and pop then pays a fence to wake sleepers. Recorded in
+        // the ring header at creation, so attach_shm follows the creator and ignores this field.
+        bool blocking = false;
+
+        // Memory placement only; blocking does not change how the ring is mapped
+        bool is_default() const noexcept { return !huge_pages && !populate && numa_node < 0; }
+    };
+
+    namespace ring_memory {
+
+        // Size of one huge page (Hugepagesize in /proc/meminfo, 2 MiB if unknown)
+        inline size_t huge_page_size() noexcept {
+            static const size_t size = [] {
+                size_t kb = 0;
+                if (FILE *f = std::fopen("/proc/meminfo", "r")) {
+                    char line[128];
+                    while (std::fgets(line, sizeof(line), f)) {
+                        if (std::sscanf(line, "Hugepagesize: %zu kB", &kb) == 1) {
+                            break;
+                        }
+                    }
+                    std::fclose(f);
+                }
+                return kb != 0 ? kb * 1024 : size_t(2) << 20;
+            }();
+            return size;
+        }
+
+        // Apply options to a new mapping, or to an attached one (fresh = false)
+        // Attached mappings are not populated here: attach_shm passes MAP_POPULATE to mmap instead.
+        inline void prepare(void *addr, size_t size, const RingOptions &options, bool fresh) noexcept {
+#if defined(__linux__)
+            if (options.huge_pages) {
+                madvise(addr, size, MADV_HUGEPAGE);
+            }
+            if (options.numa_node >= 0 && options.numa_node < 1024) {
+                unsigned long mask[1024 / (8 * sizeof(unsigned long))] = {};
+                mask[options.numa_node / (8 * sizeof(unsigned long))] |=
+                    1UL << (options.numa_node % (8 * sizeof(unsigned long)));
+                ::syscall(SYS_mbind, addr, size, MPOL_PREFERRED, mask, sizeof(mask) * 8 + 1, 0);
+            }
+#endif
+            if (!options.populate || !fresh) {
+                return;
+            }
+#if defined(MADV_POPULATE_WRITE)
+            if (madvise(addr, size, MADV_POPULATE_WRITE) == 0) {
+                return;
+            }
+#endif
+            // Older kernels: write one byte per page; the memory is new, so nothing is overwritten
+            const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            auto *bytes = static_cast<volatile uint8_t *>(addr);
+            for (size_t off = 0; off < size; off += page) {
+                bytes[off] = 0;
+            }
+        }
+
+        // Memory for an in-process ring, at least 64-byte aligned
+        // mapped is set to the mapping length to munmap later, or 0 for aligned_alloc memory.
+        inline void *allocate(size_t size, const RingOptions &options, size_t &mapped) noexcept {
+            mapped = 0;
+            if (options.is_default()) {
+                return std::aligned_alloc(64, (size + 63) / 64 * 64);
+            }
+
+            void *addr = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+            if (options.huge_pages) {
+                const size_t huge = huge_page_size();
+                const size_t length = (size + huge - 1) / huge * huge;
+                addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (addr != MAP_FAILED) {
+                    mapped = length;
+                }
+            }
+#endif
+            if (addr == MAP_FAILED) {
+                addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (addr == MAP_FAILED) {
+                    return nullptr;
+                }
+                mapped = size;
+            }
+            prepare(addr, mapped, options, true);
+            return addr;
+        }
+
+        // Release memory from allocate()
+        inline void release(void *addr, size_t mapped) noexcept {
+            if (mapped != 0) {
+                munmap(addr, mapped);
+            } else {
+                std::free(addr);
+            }
+        }
+
+    } // namespace ring_memory
+
+} // namespace datapod
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace datapod {
+
+    // ============================================================================
+    // WaitEvent - futex-backed sleep/wake for lock-free structures
+    // ============================================================================
+    //
+    // A sequence word to sleep on plus a count of sleepers. Both are plain 32-bit atomics with
+    // no process-local state, so a WaitEvent placed in shared memory lets threads of different
+    // processes wait on each other: the futex is keyed on the physical page, not the address.
+    //
+    // The caller changes its state (e.g. publishes write_pos), then calls notify(). A waiter
+    // registers, rechecks its condition and only then sleeps, so the seq_cst fence in notify()
+    // pairs with the registration and no wakeup is lost. notify() costs a fence and a load while
+    // nobody waits; the syscall is only made when the waiter count says someone is asleep.
+    //
+    // Off Linux, waiting degrades to short sleeps and notify() to a counter bump.
+
+    struct WaitEvent {
+        std::atomic<uint32_t> seq{0};
+        std::atomic<uint32_t> waiters{0};
+
+        inline void reset() noexcept {
+            seq.store(0, std::memory_order_relaxed);
+            waiters.store(0, std::memory_order_relaxed);
+        }
+
+        // Wake every waiter; call after the state change has been published
+        inline void notify() noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+            seq.fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+        }
+
+        // Sleep until notified or the deadline passes, unless ready() already holds
+        // Returns false only on timeout; wakeups may be spurious, so callers recheck and loop.
+        template <typename Ready>
+        inline bool wait(Ready &&ready, std::chrono::steady_clock::time_point deadline) noexcept {
+            uint32_t s = seq.load(std::memory_order_acquire);
+            waiters.fetch_add(1, std::memory_order_seq_cst);
+            bool woken = true;
+            if (!ready()) {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    woken = false;
+                } else {
+                    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+#if defined(__linux__)
+                    struct timespec ts;
+                    ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+                    ts.tv_nsec = static_cast<long>(ns % 1000000000);
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq), FUTEX_WAIT, s, &ts, nullptr, 0);
+#else
+                    (void)s;
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(ns < 50000 ? ns : 50000));
+#endif
+                }
+            }
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            return woken;
+        }
+    };
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex words must be plain 32-bit integers");
+
+} // namespace datapod
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <datapod/core/next_power_of_2.hpp>
+#include <datapod/pods/adapters/optional.hpp>
+
+namespace datapod {
+
+    // ============================================================================
+    // WorkStealingDeque - Chase-Lev deque (one owner, many thieves)
+    // ============================================================================
+    //
+    // The owner thread push()es and pop()s at the bottom (LIFO, so it keeps working on the task it
+    // forked last, whose data is still in cache); any other thread steal()s from the top (FIFO, so
+    // thieves take the oldest, usually largest, piece of work). push() is two stores and pop() adds
+    // one fence; the only CAS the owner does is on the last item, where it races the thieves.
+    //
+    // Follows the C11 formulation of Lê, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+    //
+    // The buffer is a power-of-two circular array that doubles when full. A thief may still be
+    // reading the old array after the owner swapped it out, so replaced arrays are kept on a chain
+    // and freed with the deque; since arrays double, they add up to less than the live one.
+    //
+    // T is copied in and out through std::atomic<T>, so it must be trivially copyable and small
+    // enough to be lock-free (task pointers, indices).
+
+    template <typename T> class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable for WorkStealingDeque");
+        static_assert(std::atomic<T>::is_always_lock_free, "T must fit in a lock-free atomic");
+
+      public:
+        explicit WorkStealingDeque(size_t capacity = 64);
+        ~WorkStealingDeque();
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+        WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+        // Owner only
+        inline void push(const T &item);
+        inline Optional<T> pop() noexcept;
+
+        // Any thread; empty when the deque is empty or another thief won the race for the item
+        inline Optional<T> steal() noexcept;
+
+        // Snapshot, exact only when no other thread is operating on the deque
+        inline size_t size() const noexcept;
+        inline bool empty() const noexcept { return size() == 0; }
+        inline size_t capacity() const noexcept { return array_.load(std::memory_order_relaxed)->size(); }
+
+      private:
+        struct Array {
+            explicit Array(size_t capacity, Array *prev)
+                : mask_(static_cast<int64_t>(capacity) - 1), slots_(new std::atomic<T>[capacity]), prev_(prev) {}
+            ~Array() { delete[] slots_; }
+
+            size_t size() const noexcept { return static_cast<size_t>(mask_ + 1); }
+            T get(int64_t i) const noexcept { return slots_[i & mask_].load(std::memory_order_relaxed); }
+            void put(int64_t i, const T &item) noexcept { slots_[i & mask_].store(item, std::memory_order_relaxed); }
+
+            int64_t mask_;
+            std::atomic<T> *slots_;
+            Array *prev_; // The array this one replaced, still readable by slow thieves
+        };
+
+        // top_ is written by thieves, bottom_ by the owner: keep them on separate cache lines
+        alignas(64) std::atomic<int64_t> top_;
+        alignas(64) std::atomic<int64_t> bottom_;
+        alignas(64) std::atomic<Array *> array_;
+
+        Array *grow(Array *a, int64_t top, int64_t bottom);
+    };
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    template <typename T> WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : top_(0), bottom_(0) {
+        capacity = capacity <= 2 ? 2 : next_power_of_two(capacity);
+        array_.store(new Array(capacity, nullptr), std::memory_order_relaxed);
+    }
+
+    template <typename T> WorkStealingDeque<T>::~WorkStealingDeque() {
+        Array *a = array_.load(std::memory_order_relaxed);
+        while (a) {
+            Array *prev = a->prev_;
+            delete a;
+            a = prev;
+        }
+    }
+
+    template <typename T>
+    typename WorkStealingDeque<T>::Array *WorkStealingDeque<T>::grow(Array *a, int64_t top, int64_t bottom) {
+        Array *bigger = new Array(a->size() * 2, a);
+        for (int64_t i = top; i < bottom; i++) {
+            bigger->put(i, a->get(i));
+        }
+        array_.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    template <typename T> inline void WorkStealingDeque<T>::push(const T &item) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        Array *a = array_.load(std::memory_order_relaxed);
+        if (b - t > a->mask_) {
+            a = grow(a, t, b);
+        }
+        a->put(b, item);
+        bottom_.store(b + 1, std::memory_order_release); // Publishes the item to thieves
+    }
+
+    template <typename T> inline Optional<T> WorkStealingDeque<T>::pop() noexcept {
+        // Claim the bottom item first, then look at top: a thief that read the old bottom either
+        // loses the CAS below or took an item the owner no longer counts
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array *a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed); // Was empty
+            return nullopt;
+        }
+        T item = a->get(b);
+        if (t == b) {
+            // Last item: race the thieves for it
+            bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return nullopt;
+            }
+        }
+        return item;
+    }
+
+    template <typename T> inline Optional<T> WorkStealingDeque<T>::steal() noexcept {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullopt;
+        }
+
+        // Read before claiming: once top moves, the owner may overwrite the slot
+        Array *a = array_.load(std::memory_order_acquire);
+        T item = a->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullopt;
+        }
+        return item;
+    }
+
+    template <typename T> inline size_t WorkStealingDeque<T>::size() const noexcept {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+} // namespace datapod
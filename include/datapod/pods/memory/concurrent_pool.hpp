@@ -0,0 +1,350 @@
+#pragma once
+#include <datapod/types/types.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace datapod {
+
+    /// Thread-safe pool allocator for fixed-size blocks, for objects that are allocated on one
+    /// thread and freed on another (e.g. messages handed from a driver thread to workers).
+    ///
+    /// Free blocks move between threads in batches. Each thread works through its own Cache, which
+    /// allocates and frees without any atomic operation; a cache that runs dry takes a whole batch
+    /// from the shared free list with one CAS, and a cache that fills up (a worker freeing messages
+    /// it did not allocate) returns a batch with one CAS. Only when the shared list is empty does
+    /// the pool take a mutex to carve a new chunk.
+    ///
+    /// The shared list is a Treiber stack of batches. Its head packs a 32-bit block index with a
+    /// 32-bit tag bumped on every update, so a head that was popped and pushed back in between
+    /// (ABA) fails the CAS. The link from one batch to the next lives in a side table next to each
+    /// chunk, never inside a block, so a thread holding a stale head never reads memory that
+    /// another thread is already using as a T.
+    ///
+    /// Chunks double in size and are only freed with the pool; every Cache must be destroyed first.
+    template <typename T> class ConcurrentPool {
+        struct FreeNode {
+            FreeNode *next;
+            datapod::usize count; // Blocks in the batch, valid in a batch's first block
+
+            unsigned char *bytes() noexcept { return reinterpret_cast<unsigned char *>(this); }
+        };
+
+        static constexpr std::uint32_t NIL = UINT32_MAX;
+        static constexpr datapod::usize MAX_CHUNKS = 24;
+
+        struct Chunk {
+            unsigned char *memory;
+            std::atomic<std::uint32_t> *links; // Next batch on the shared list, per block
+            std::uint32_t base;                // Index of the first block
+            std::uint32_t blocks;
+        };
+
+      public:
+        using value_type = T;
+        using size_type = datapod::usize;
+
+        class Cache;
+
+        /// chunk_size: blocks in the first chunk; batch_size: blocks moved per shared-list operation
+        explicit ConcurrentPool(size_type chunk_size = 256, size_type batch_size = 32);
+        ~ConcurrentPool();
+
+        ConcurrentPool(ConcurrentPool const &) = delete;
+        ConcurrentPool &operator=(ConcurrentPool const &) = delete;
+
+        /// Allocate or free one block without a cache (one CAS each, for occasional use)
+        T *allocate();
+        void deallocate(T *ptr) noexcept;
+
+        /// Construct and destroy through a cache-less allocate()/deallocate()
+        template <typename... Args> T *create(Args &&...args) {
+            T *p = allocate();
+            try {
+                return new (p) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(p);
+                throw;
+            }
+        }
+        void destroy(T *ptr) noexcept {
+            if (ptr != nullptr) {
+                ptr->~T();
+                deallocate(ptr);
+            }
+        }
+
+        /// Get batch size (blocks per shared-list transfer)
+        size_type batch_size() const noexcept { return batch_size_; }
+
+        /// Count chunks allocated so far
+        size_type chunk_count() const noexcept { return chunk_count_.load(std::memory_order_acquire); }
+
+        /// Get total capacity (number of blocks across all chunks)
+        size_type capacity() const noexcept {
+            size_type n = chunk_count();
+            return n == 0 ? 0 : chunks_[n - 1].base + chunks_[n - 1].blocks;
+        }
+
+      private:
+        /// Calculate block size with proper alignment
+        static constexpr size_type block_size() noexcept {
+            size_type size = sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode);
+            size_type align = alignof(T) > alignof(FreeNode) ? alignof(T) : alignof(FreeNode);
+            return (size + align - 1) & ~(align - 1);
+        }
+
+        static constexpr std::uint64_t pack(std::uint32_t tag, std::uint32_t index) noexcept {
+            return (static_cast<std::uint64_t>(tag) << 32) | index;
+        }
+        static constexpr std::uint32_t index_of(std::uint64_t head) noexcept {
+            return static_cast<std::uint32_t>(head);
+        }
+        static constexpr std::uint32_t tag_of(std::uint64_t head) noexcept {
+            return static_cast<std::uint32_t>(head >> 32);
+        }
+
+        // Chunk k holds chunk_size << k blocks, so the chunk of an index follows from its bit width
+        Chunk const &chunk_of(std::uint32_t index) const noexcept {
+            auto const k = std::bit_width((static_cast<std::uint64_t>(index) >> chunk_shift_) + 1) - 1;
+            return chunks_[k];
+        }
+
+        FreeNode *block(std::uint32_t index) const noexcept {
+            Chunk const &c = chunk_of(index);
+            return reinterpret_cast<FreeNode *>(c.memory + static_cast<size_type>(index - c.base) * block_size());
+        }
+
+        std::uint32_t index_of_block(void const *ptr) const noexcept {
+            auto const *p = static_cast<unsigned char const *>(ptr);
+            size_type const n = chunk_count();
+            for (size_type k = 0; k < n; ++k) {
+                Chunk const &c = chunks_[k];
+                if (p >= c.memory && p < c.memory + static_cast<size_type>(c.blocks) * block_size()) {
+                    return c.base + static_cast<std::uint32_t>((p - c.memory) / block_size());
+                }
+            }
+            return NIL;
+        }
+
+        /// Push a linked batch (first->...->last, count blocks) onto the shared list
+        void push_batch(FreeNode *first, size_type count) noexcept;
+
+        /// Pop a batch from the shared list: null when it is empty, or carve a new chunk (pop_batch)
+        FreeNode *try_pop_batch() noexcept;
+        FreeNode *pop_batch();
+
+        FreeNode *grow();
+
+        Chunk chunks_[MAX_CHUNKS];
+        std::atomic<size_type> chunk_count_{0};
+        alignas(64) std::atomic<std::uint64_t> head_;
+        alignas(64) std::mutex grow_mutex_;
+        size_type chunk_shift_;
+        size_type batch_size_;
+    };
+
+    /// Per-thread front end: allocate/deallocate touch only this object until it needs a batch from,
+    /// or has a batch for, the shared list. Not thread-safe itself; create one per thread.
+    template <typename T> class ConcurrentPool<T>::Cache {
+      public:
+        explicit Cache(ConcurrentPool &pool) noexcept : pool_(&pool), head_(nullptr), count_(0) {}
+        ~Cache() { flush(); }
+
+        Cache(Cache const &) = delete;
+        Cache &operator=(Cache const &) = delete;
+
+        T *allocate() {
+            if (head_ == nullptr) {
+                head_ = pool_->pop_batch();
+                count_ = head_->count;
+            }
+            FreeNode *node = head_;
+            head_ = node->next;
+            --count_;
+            return reinterpret_cast<T *>(node);
+        }
+
+        /// Free a block from any thread's cache or the pool itself
+        /// Once two batches have piled up, one is returned to the shared list.
+        void deallocate(T *ptr) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            FreeNode *node = reinterpret_cast<FreeNode *>(ptr);
+            node->next = head_;
+            head_ = node;
+            if (++count_ >= 2 * pool_->batch_size_) {
+                release(pool_->batch_size_);
+            }
+        }
+
+        template <typename... Args> T *create(Args &&...args) {
+            T *p = allocate();
+            try {
+                return new (p) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(p);
+                throw;
+            }
+        }
+        void destroy(T *ptr) noexcept {
+            if (ptr != nullptr) {
+                ptr->~T();
+                deallocate(ptr);
+            }
+        }
+
+        /// Return every cached block to the shared list
+        void flush() noexcept {
+            while (count_ > 0) {
+                release(count_ < pool_->batch_size_ ? count_ : pool_->batch_size_);
+            }
+        }
+
+        /// Get number of blocks held by this cache
+        size_type cached() const noexcept { return count_; }
+
+      private:
+        // Hand the first n cached blocks to the shared list as one batch
+        void release(size_type n) noexcept {
+            FreeNode *first = head_;
+            FreeNode *last = first;
+            for (size_type i = 1; i < n; ++i) {
+                last = last->next;
+            }
+            head_ = last->next;
+            last->next = nullptr;
+            count_ -= n;
+            pool_->push_batch(first, n);
+        }
+
+        ConcurrentPool *pool_;
+        FreeNode *head_;
+        size_type count_;
+    };
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    template <typename T>
+    ConcurrentPool<T>::ConcurrentPool(size_type chunk_size, size_type batch_size)
+        : chunks_{}, head_(pack(0, NIL)),
+          chunk_shift_(static_cast<size_type>(std::bit_width(std::bit_ceil(chunk_size < 2 ? 2 : chunk_size)) - 1)),
+          batch_size_(batch_size == 0 ? 1 : batch_size) {}
+
+    template <typename T> ConcurrentPool<T>::~ConcurrentPool() {
+        size_type const n = chunk_count();
+        for (size_type k = 0; k < n; ++k) {
+            std::free(chunks_[k].memory);
+            delete[] chunks_[k].links;
+        }
+    }
+
+    template <typename T> void ConcurrentPool<T>::push_batch(FreeNode *first, size_type count) noexcept {
+        first->count = count;
+        std::uint32_t const index = index_of_block(first);
+        Chunk const &c = chunk_of(index);
+        std::atomic<std::uint32_t> &link = c.links[index - c.base];
+
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        do {
+            link.store(index_of(head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, pack(tag_of(head) + 1, index), std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    template <typename T> typename ConcurrentPool<T>::FreeNode *ConcurrentPool<T>::try_pop_batch() noexcept {
+        std::uint64_t head = head_.load(std::memory_order_acquire);
+        while (index_of(head) != NIL) {
+            // May be stale if head moved meanwhile; the tag makes the CAS fail in that case
+            Chunk const &c = chunk_of(index_of(head));
+            std::uint32_t const next = c.links[index_of(head) - c.base].load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, pack(tag_of(head) + 1, next), std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                return block(index_of(head));
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T> typename ConcurrentPool<T>::FreeNode *ConcurrentPool<T>::pop_batch() {
+        FreeNode *batch = try_pop_batch();
+        return batch != nullptr ? batch : grow();
+    }
+
+    template <typename T> typename ConcurrentPool<T>::FreeNode *ConcurrentPool<T>::grow() {
+        std::lock_guard<std::mutex> lock(grow_mutex_);
+
+        // Another thread may have grown the pool while this one waited
+        if (FreeNode *batch = try_pop_batch()) {
+            return batch;
+        }
+
+        size_type const k = chunk_count_.load(std::memory_order_relaxed);
+        size_type const blocks = size_type{1} << (chunk_shift_ + k);
+        size_type const base = ((size_type{1} << k) - 1) << chunk_shift_;
+        if (k == MAX_CHUNKS || base + blocks >= NIL) {
+            throw std::bad_alloc();
+        }
+
+        size_type const align = alignof(T) > alignof(FreeNode) ? alignof(T) : alignof(FreeNode);
+        size_type const bytes = (blocks * block_size() + align - 1) / align * align;
+        auto *memory = static_cast<unsigned char *>(std::aligned_alloc(align, bytes));
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        auto *links = new (std::nothrow) std::atomic<std::uint32_t>[blocks];
+        if (links == nullptr) {
+            std::free(memory);
+            throw std::bad_alloc();
+        }
+
+        Chunk &c = chunks_[k];
+        c.memory = memory;
+        c.links = links;
+        c.base = static_cast<std::uint32_t>(base);
+        c.blocks = static_cast<std::uint32_t>(blocks);
+        chunk_count_.store(k + 1, std::memory_order_release);
+
+        // Carve the chunk into batches: the first goes to the caller, the rest to the shared list
+        for (size_type start = 0; start < blocks; start += batch_size_) {
+            size_type const n = blocks - start < batch_size_ ? blocks - start : batch_size_;
+            auto *first = reinterpret_cast<FreeNode *>(memory + start * block_size());
+            for (size_type i = 0; i < n; ++i) {
+                auto *node = reinterpret_cast<FreeNode *>(memory + (start + i) * block_size());
+                node->next = i + 1 < n ? reinterpret_cast<FreeNode *>(node->bytes() + block_size()) : nullptr;
+            }
+            first->count = n;
+            if (start != 0) {
+                push_batch(first, n);
+            }
+        }
+        return reinterpret_cast<FreeNode *>(memory);
+    }
+
+    template <typename T> T *ConcurrentPool<T>::allocate() {
+        FreeNode *batch = pop_batch();
+        if (batch->next != nullptr) {
+            push_batch(batch->next, batch->count - 1);
+        }
+        return reinterpret_cast<T *>(batch);
+    }
+
+    template <typename T> void ConcurrentPool<T>::deallocate(T *ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        auto *node = reinterpret_cast<FreeNode *>(ptr);
+        node->next = nullptr;
+        push_batch(node, 1);
+    }
+
+} // namespace datapod
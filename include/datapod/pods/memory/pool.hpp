@@ -15,6 +15,7 @@ namespace datapod {
     /// Provides O(1) allocation and deallocation by maintaining a linked list of free blocks.
     /// All allocations are the same size (sizeof(T)), making it extremely efficient
     /// for containers that allocate many objects of the same type.
+    /// Not thread-safe; ConcurrentPool covers blocks freed on a different thread than allocated them.
     template <typename T> class Pool {
       public:
         using value_type = T;
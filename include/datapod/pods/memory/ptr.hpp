@@ -60,6 +60,11 @@ namespace datapod {
 
     template <typename T> using ptr_value_t = typename PtrValueType<T>::type;
 
+    // Raw address behind either pointer flavour
+    template <typename T> T *to_ptr(T *p) noexcept { return p; }
+
+    template <typename T> T *to_ptr(OffsetPtr<T> const &p) noexcept { return p.get(); }
+
     namespace ptr_ns {
         /// Placeholder for template/container type (no useful make() function)
         inline void unimplemented() {}
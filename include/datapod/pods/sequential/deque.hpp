@@ -24,7 +24,7 @@ namespace datapod {
      * Useful for:
      * - BFS (breadth-first search)
      * - Sliding window algorithms
-     * - Work-stealing queues
+     * - Single-threaded work queues (concurrent work stealing: WorkStealingDeque in pods/lockfree)
      * - Any case where O(1) operations at both ends are needed
      *
      * @tparam T Value type
@@ -10,6 +10,8 @@
 #include <string_view>
 #include <type_traits>
 
+#include "datapod/pods/memory/offset_ptr.hpp"
+
 namespace datapod {
 
     // Basic string with Small String Optimization (SSO)
@@ -24,6 +26,9 @@ namespace datapod {
         using pointer = Ptr;
         using const_pointer = char const *;
 
+        // Heap pointer storage: raw pointer, or self-relative offset for offset::String
+        using heap_storage_type = std::conditional_t<is_offset_ptr_v<Ptr>, offset_t, char *>;
+
         static constexpr size_type SSO_SIZE = 23;
         static constexpr size_type npos = static_cast<size_type>(-1);
 
@@ -40,9 +45,9 @@ namespace datapod {
                 sso_data_[len] = '\0';
             } else {
                 capacity_ = len;
-                heap_data_ = new char[capacity_ + 1]; // +1 for null terminator
-                std::memcpy(heap_data_, str, len);
-                heap_data_[len] = '\0';
+                set_heap(new char[capacity_ + 1]); // +1 for null terminator
+                std::memcpy(heap(), str, len);
+                heap()[len] = '\0';
             }
         }
 
@@ -58,8 +63,8 @@ namespace datapod {
                 std::memcpy(sso_data_, other.sso_data_, size_ + 1);
             } else {
                 capacity_ = other.capacity_;
-                heap_data_ = new char[capacity_ + 1]; // +1 for null terminator
-                std::memcpy(heap_data_, other.heap_data_, size_ + 1);
+                set_heap(new char[capacity_ + 1]); // +1 for null terminator
+                std::memcpy(heap(), other.heap(), size_ + 1);
             }
         }
 
@@ -68,9 +73,9 @@ namespace datapod {
             if (is_sso_) {
                 std::memcpy(sso_data_, other.sso_data_, size_ + 1);
             } else {
-                heap_data_ = other.heap_data_;
+                set_heap(other.heap());
                 capacity_ = other.capacity_;
-                other.heap_data_ = nullptr;
+                other.set_heap(nullptr);
                 other.size_ = 0;
                 other.is_sso_ = true;
                 other.sso_data_[0] = '\0';
@@ -79,8 +84,8 @@ namespace datapod {
 
         // Destructor
         ~BasicString() {
-            if (!is_sso_ && heap_data_ != nullptr) {
-                delete[] heap_data_;
+            if (!is_sso_ && heap() != nullptr) {
+                delete[] heap();
             }
         }
 
@@ -133,9 +138,9 @@ namespace datapod {
 
         const_reference back() const noexcept { return data()[size_ - 1]; }
 
-        char *data() noexcept { return is_sso_ ? sso_data_ : heap_data_; }
+        char *data() noexcept { return is_sso_ ? sso_data_ : heap(); }
 
-        char const *data() const noexcept { return is_sso_ ? sso_data_ : heap_data_; }
+        char const *data() const noexcept { return is_sso_ ? sso_data_ : heap(); }
 
         char const *c_str() const noexcept { return data(); }
 
@@ -160,16 +165,16 @@ namespace datapod {
             // Reallocate to exact size + 1 for null terminator
             char *new_data = new char[size_ + 1];
             std::memcpy(new_data, data(), size_ + 1);
-            delete[] heap_data_;
-            heap_data_ = new_data;
+            delete[] heap();
+            set_heap(new_data);
             capacity_ = size_;
         }
 
         // Operations
         void clear() noexcept {
-            if (!is_sso_ && heap_data_ != nullptr) {
-                delete[] heap_data_;
-                heap_data_ = nullptr;
+            if (!is_sso_ && heap() != nullptr) {
+                delete[] heap();
+                set_heap(nullptr);
             }
             size_ = 0;
             is_sso_ = true;
@@ -195,7 +200,9 @@ namespace datapod {
                 std::memcpy(other.sso_data_, temp, SSO_SIZE + 1);
             } else if (!this_is_sso && !other_is_sso) {
                 // Both use heap - swap pointers and capacity
-                std::swap(heap_data_, other.heap_data_);
+                char *other_heap = other.heap();
+                other.set_heap(heap());
+                set_heap(other_heap);
                 std::swap(capacity_, other.capacity_);
             } else {
                 // Mixed mode - need to swap union carefully
@@ -206,17 +213,17 @@ namespace datapod {
                 if (this_is_sso) {
                     // this uses SSO, other uses heap
                     std::memcpy(temp_sso, sso_data_, SSO_SIZE + 1);
-                    temp_heap = other.heap_data_;
+                    temp_heap = other.heap();
                     temp_cap = other.capacity_;
-                    heap_data_ = temp_heap;
+                    set_heap(temp_heap);
                     capacity_ = temp_cap;
                     std::memcpy(other.sso_data_, temp_sso, SSO_SIZE + 1);
                 } else {
                     // this uses heap, other uses SSO
                     std::memcpy(temp_sso, other.sso_data_, SSO_SIZE + 1);
-                    temp_heap = heap_data_;
+                    temp_heap = heap();
                     temp_cap = capacity_;
-                    other.heap_data_ = temp_heap;
+                    other.set_heap(temp_heap);
                     other.capacity_ = temp_cap;
                     std::memcpy(sso_data_, temp_sso, SSO_SIZE + 1);
                 }
@@ -351,12 +358,12 @@ namespace datapod {
             std::memcpy(new_data, data(), size_ + 1);
 
             // Clean up old data if heap
-            if (!is_sso_ && heap_data_ != nullptr) {
-                delete[] heap_data_;
+            if (!is_sso_ && heap() != nullptr) {
+                delete[] heap();
             }
 
             // Switch to heap mode
-            heap_data_ = new_data;
+            set_heap(new_data);
             capacity_ = new_cap;
             is_sso_ = false;
         }
@@ -1378,14 +1385,39 @@ namespace datapod {
         auto members() noexcept { return std::tie(size_, is_sso_); }
         auto members() const noexcept { return std::tie(size_, is_sso_); }
 
+        // Address of the heap pointer slot (used by the view serializer to patch offsets)
+        heap_storage_type const *heap_slot() const noexcept { return &heap_data_; }
+
       private:
+        char *heap() const noexcept {
+            if constexpr (is_offset_ptr_v<Ptr>) {
+                if (heap_data_ == NULLPTR_OFFSET) {
+                    return nullptr;
+                }
+                return reinterpret_cast<char *>(reinterpret_cast<std::uintptr_t>(&heap_data_) +
+                                                static_cast<std::intptr_t>(heap_data_));
+            } else {
+                return heap_data_;
+            }
+        }
+
+        void set_heap(char *p) noexcept {
+            if constexpr (is_offset_ptr_v<Ptr>) {
+                heap_data_ = p == nullptr ? NULLPTR_OFFSET
+                                          : static_cast<offset_t>(reinterpret_cast<std::uintptr_t>(p) -
+                                                                  reinterpret_cast<std::uintptr_t>(&heap_data_));
+            } else {
+                heap_data_ = p;
+            }
+        }
+
         size_type size_;
         bool is_sso_;
 
         union {
             char sso_data_[SSO_SIZE + 1]; // +1 for null terminator
             __extension__ struct {
-                char *heap_data_;
+                heap_storage_type heap_data_;
                 size_type capacity_;
             };
         };
@@ -1584,6 +1616,10 @@ namespace datapod {
 
     using String = BasicString<char *>;
 
+    namespace offset {
+        using String = BasicString<OffsetPtr<char>>;
+    }
+
     namespace seq_string {
         /// Placeholder for template container type (no useful make() function)
         inline void unimplemented() {}
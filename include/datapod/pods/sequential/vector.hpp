@@ -9,6 +9,7 @@
 
 #include "datapod/core/strong.hpp"
 #include "datapod/pods/memory/allocator.hpp"
+#include "datapod/pods/memory/ptr.hpp"
 
 namespace datapod {
 
@@ -74,7 +75,7 @@ namespace datapod {
         ~BasicVector() {
             clear();
             if (data_ != nullptr) {
-                alloc_.deallocate(data_, capacity_);
+                alloc_.deallocate(data(), capacity_);
             }
         }
 
@@ -94,7 +95,7 @@ namespace datapod {
             if (this != &other) {
                 clear();
                 if (data_ != nullptr) {
-                    alloc_.deallocate(data_, capacity_);
+                    alloc_.deallocate(data(), capacity_);
                 }
 
                 data_ = other.data_;
@@ -153,22 +154,22 @@ namespace datapod {
 
         const_reference back() const noexcept { return data_[size_ - 1]; }
 
-        T *data() noexcept { return data_; }
+        T *data() noexcept { return to_ptr(data_); }
 
-        T const *data() const noexcept { return data_; }
+        T const *data() const noexcept { return to_ptr(data_); }
 
         // Iterators
-        iterator begin() noexcept { return data_; }
+        iterator begin() noexcept { return data(); }
 
-        const_iterator begin() const noexcept { return data_; }
+        const_iterator begin() const noexcept { return data(); }
 
-        const_iterator cbegin() const noexcept { return data_; }
+        const_iterator cbegin() const noexcept { return data(); }
 
-        iterator end() noexcept { return data_ + size_; }
+        iterator end() noexcept { return data() + size_; }
 
-        const_iterator end() const noexcept { return data_ + size_; }
+        const_iterator end() const noexcept { return data() + size_; }
 
-        const_iterator cend() const noexcept { return data_ + size_; }
+        const_iterator cend() const noexcept { return data() + size_; }
 
         reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
         const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
@@ -201,7 +202,7 @@ namespace datapod {
             }
 
             if (data_ != nullptr) {
-                alloc_.deallocate(data_, capacity_);
+                alloc_.deallocate(data(), capacity_);
             }
 
             data_ = new_data;
@@ -215,7 +216,7 @@ namespace datapod {
 
             if (size_ == 0) {
                 if (data_ != nullptr) {
-                    alloc_.deallocate(data_, capacity_);
+                    alloc_.deallocate(data(), capacity_);
                     data_ = nullptr;
                 }
                 capacity_ = 0;
@@ -229,7 +230,7 @@ namespace datapod {
                 alloc_.destroy(&data_[i]);
             }
 
-            alloc_.deallocate(data_, capacity_);
+            alloc_.deallocate(data(), capacity_);
             data_ = new_data;
             capacity_ = size_;
         }
@@ -490,7 +491,7 @@ namespace datapod {
             return std::max(needed, grown);
         }
 
-        T *data_;
+        Ptr data_;
         size_type size_;
         size_type capacity_;
         [[no_unique_address]] Alloc alloc_;
@@ -499,6 +500,10 @@ namespace datapod {
     // Type aliases
     template <typename T> using Vector = BasicVector<T, T *, Allocator<T>>;
 
+    namespace offset {
+        template <typename T> using Vector = BasicVector<T, OffsetPtr<T>, Allocator<T>>;
+    }
+
     // VectorMap - vector indexed by Key type (supports Strong types)
     template <typename Key, typename Value> using VectorMap = BasicVector<Value, Value *, Allocator<Value>, Key>;
 
@@ -1,12 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <limits>
-#include <memory>
+#include <utility>
 #include <vector>
 
 #include "datapod/core/hash.hpp"
+#include "datapod/core/mode.hpp"
 #include "datapod/core/offset_t.hpp"
 #include "datapod/core/verify.hpp"
 #include "datapod/serialization/serialized_size.hpp"
@@ -16,10 +17,44 @@ namespace datapod {
     // Byte buffer type (std::vector<uint8_t>)
     using ByteBuf = std::vector<datapod::u8>;
 
+    // Incremental integrity checksum: XXH64, or byte-wise FNV-1a under Mode::FNV_INTEGRITY
+    struct IntegrityHasher {
+        explicit IntegrityHasher(bool const fnv = false) noexcept : fnv_{fnv} {}
+
+        template <Mode M> static IntegrityHasher for_mode() noexcept {
+            return IntegrityHasher{is_mode_enabled(M, Mode::FNV_INTEGRITY)};
+        }
+
+        void update(void const *p, datapod::usize const n) noexcept {
+            if (fnv_) {
+                fnv_hash_ = hash(std::string_view{static_cast<char const *>(p), n}, fnv_hash_);
+            } else {
+                bulk_.update(p, n);
+            }
+        }
+
+        hash_t digest() const noexcept { return fnv_ ? fnv_hash_ : bulk_.digest(); }
+
+        template <Mode M> bool is_mode() const noexcept { return fnv_ == is_mode_enabled(M, Mode::FNV_INTEGRITY); }
+
+        bool fnv_;
+        hash_t fnv_hash_{BASE_HASH};
+        BulkHasher bulk_{};
+    };
+
+    template <Mode M> hash_t integrity_checksum(void const *p, datapod::usize const n) noexcept {
+        auto h = IntegrityHasher::for_mode<M>();
+        h.update(p, n);
+        return h.digest();
+    }
+
+    // Running checksums are fed in steps of this many bytes, small enough to still be in cache
+    constexpr datapod::usize INTEGRITY_STEP_BYTES = 16U * 1024U;
+
     // Buffer target for serialization
     template <typename BufType = ByteBuf> struct Buf {
         Buf() = default;
-        explicit Buf(BufType &&buf) : buf_{std::forward<BufType>(buf)} {}
+        explicit Buf(BufType &&buf) : buf_{std::forward<BufType>(buf)}, size_{buf_.size()} {}
 
         // Get address at offset
         datapod::u8 *addr(offset_t const offset) noexcept { return (&buf_[0U]) + offset; }
@@ -27,57 +62,186 @@ namespace datapod {
         // Get base address
         datapod::u8 *base() noexcept { return &buf_[0U]; }
 
+        // Hash bytes from the given offset on as they are written, so checksum() needs no second pass
+        template <Mode M = Mode::NONE> void begin_checksum(offset_t const start) noexcept {
+            hashing_ = true;
+            hash_dirty_ = false;
+            hash_start_ = hashed_ = static_cast<datapod::usize>(start);
+            hasher_ = IntegrityHasher::for_mode<M>();
+        }
+
         // Compute checksum from given start offset
-        datapod::u64 checksum(offset_t const start = 0U) const noexcept {
-            return hash(std::string_view{reinterpret_cast<char const *>(&buf_[static_cast<datapod::usize>(start)]),
-                                         buf_.size() - static_cast<datapod::usize>(start)});
+        // Finishes the running hash when it covers exactly that range, otherwise hashes the buffer
+        template <Mode M = Mode::NONE> datapod::u64 checksum(offset_t const start = 0U) noexcept {
+            if (hashing_ && !hash_dirty_ && hash_start_ == static_cast<datapod::usize>(start) &&
+                hasher_.template is_mode<M>()) {
+                hash_pending(0U);
+                return hasher_.digest();
+            }
+            return integrity_checksum<M>(buf_.data() + static_cast<datapod::usize>(start),
+                                         size_ - static_cast<datapod::usize>(start));
+        }
+
+        // Pre-allocate room for num_bytes more bytes (e.g. from serialized_size_of)
+        // Subsequent writes fill the storage in place instead of growing it on every call
+        void allocate(datapod::usize const num_bytes) {
+            if (buf_.size() < size_ + num_bytes) {
+                buf_.resize(size_ + num_bytes);
+            }
         }
 
         // Write a value at a specific position
         template <typename T> void write(datapod::usize const pos, T const &val) {
-            verify(buf_.size() >= pos + serialized_size<T>(), "out of bounds write");
+            verify(size_ >= pos + serialized_size<T>(), "out of bounds write");
             std::memcpy(&buf_[pos], &val, serialized_size<T>());
+            hash_dirty_ = hash_dirty_ || (hashing_ && pos < hashed_ && pos + serialized_size<T>() > hash_start_);
         }
 
         // Write raw data with optional alignment
+        // Alignment is relative to the buffer start, matching DeserializationContext::align
         offset_t write(void const *ptr, datapod::usize const num_bytes, datapod::usize alignment = 0U) {
-            auto start = static_cast<offset_t>(size());
-
-            // Handle alignment
-            if (alignment > 1U && buf_.size() != 0U) {
-                auto unaligned_ptr = static_cast<void *>(addr(start));
-                auto space = static_cast<std::size_t>(std::numeric_limits<datapod::usize>::max());
-                auto const aligned_ptr = std::align(alignment, num_bytes, unaligned_ptr, space);
-                auto const new_offset =
-                    static_cast<offset_t>(aligned_ptr ? static_cast<datapod::u8 *>(aligned_ptr) - base() : 0U);
-                auto const adjustment = static_cast<offset_t>(new_offset - start);
-                start += adjustment;
+            auto start = size_;
+            if (alignment > 1U) {
+                start = (start + alignment - 1U) / alignment * alignment;
             }
 
-            // Ensure buffer has enough space
-            auto const space_left = static_cast<int64_t>(buf_.size()) - static_cast<int64_t>(start);
-            if (space_left < static_cast<int64_t>(num_bytes)) {
-                auto const missing = static_cast<datapod::usize>(static_cast<int64_t>(num_bytes) - space_left);
-                buf_.resize(buf_.size() + missing);
+            // Grow only if the pre-allocated storage is exhausted
+            if (buf_.size() < start + num_bytes) {
+                buf_.resize(start + num_bytes);
             }
 
-            // Copy data
-            std::memcpy(addr(start), ptr, num_bytes);
+            // Copy data; with a running checksum, large writes are hashed step by step while cached
+            if (hashing_ && num_bytes > INTEGRITY_STEP_BYTES) {
+                auto const *src = static_cast<datapod::u8 const *>(ptr);
+                for (datapod::usize done = 0U; done != num_bytes;) {
+                    auto const step = std::min(INTEGRITY_STEP_BYTES, num_bytes - done);
+                    std::memcpy(addr(static_cast<offset_t>(start + done)), src + done, step);
+                    done += step;
+                    size_ = start + done;
+                    hash_pending(0U);
+                }
+            } else if (num_bytes != 0U) {
+                std::memcpy(addr(static_cast<offset_t>(start)), ptr, num_bytes);
+            }
+            size_ = start + num_bytes;
+            if (hashing_) {
+                hash_pending(INTEGRITY_STEP_BYTES);
+            }
 
-            return start;
+            return static_cast<offset_t>(start);
+        }
+
+        // Roll back to an earlier size, zeroing the dropped bytes so later alignment padding stays zero
+        // A running checksum that already took in dropped bytes is abandoned: checksum() then hashes the buffer.
+        void truncate(offset_t const offset) noexcept {
+            auto const size = static_cast<datapod::usize>(offset);
+            if (size >= size_) {
+                return;
+            }
+            std::memset(addr(offset), 0, size_ - size);
+            size_ = size;
+            if (hashed_ > size) {
+                hashing_ = false;
+                hashed_ = size;
+            }
         }
 
         // Array access operators
         datapod::u8 &operator[](datapod::usize const i) noexcept { return buf_[i]; }
         datapod::u8 const &operator[](datapod::usize const i) const noexcept { return buf_[i]; }
 
-        // Get buffer size
-        datapod::usize size() const noexcept { return buf_.size(); }
+        // Get written size
+        datapod::usize size() const noexcept { return size_; }
 
         // Reset buffer
-        void reset() { buf_.resize(0U); }
+        void reset() {
+            buf_.resize(0U);
+            size_ = 0U;
+            hashing_ = false;
+        }
+
+        // Take the written bytes, dropping any unused pre-allocated tail
+        BufType release() {
+            buf_.resize(size_);
+            size_ = 0U;
+            hashing_ = false;
+            return std::move(buf_);
+        }
 
         BufType buf_;
+        datapod::usize size_{0U};
+
+      private:
+        // Feed the running hash once at least min_bytes are pending
+        void hash_pending(datapod::usize const min_bytes) noexcept {
+            if (size_ - hashed_ >= min_bytes && size_ != hashed_) {
+                hasher_.update(buf_.data() + hashed_, size_ - hashed_);
+                hashed_ = size_;
+            }
+        }
+
+        IntegrityHasher hasher_{};
+        bool hashing_{false};
+        bool hash_dirty_{false};
+        datapod::usize hash_start_{0U};
+        datapod::usize hashed_{0U};
+    };
+
+    // Serialization target that only measures: same interface as Buf, no storage
+    // Running serialize() against it yields the exact encoded size including alignment padding
+    struct SizeCounter {
+        offset_t write(void const *, datapod::usize const num_bytes, datapod::usize alignment = 0U) noexcept {
+            auto start = size_;
+            if (alignment > 1U) {
+                start = (start + alignment - 1U) / alignment * alignment;
+            }
+            size_ = start + num_bytes;
+            return static_cast<offset_t>(start);
+        }
+
+        template <typename T> void write(datapod::usize const, T const &) noexcept {}
+
+        datapod::usize size() const noexcept { return size_; }
+
+        datapod::usize size_{0U};
+    };
+
+    // Serialization target over a fixed, caller-owned region (e.g. a ByteRing reservation)
+    // Never allocates; writing past the end fails verify(), so size the region with serialized_size_of
+    struct RegionBuf {
+        RegionBuf(datapod::u8 *data, datapod::usize const capacity) noexcept : data_{data}, capacity_{capacity} {}
+
+        template <Mode M = Mode::NONE> datapod::u64 checksum(offset_t const start = 0U) const noexcept {
+            return integrity_checksum<M>(data_ + static_cast<datapod::usize>(start),
+                                         size_ - static_cast<datapod::usize>(start));
+        }
+
+        template <typename T> void write(datapod::usize const pos, T const &val) {
+            verify(size_ >= pos + serialized_size<T>(), "out of bounds write");
+            std::memcpy(data_ + pos, &val, serialized_size<T>());
+        }
+
+        offset_t write(void const *ptr, datapod::usize const num_bytes, datapod::usize alignment = 0U) {
+            auto start = size_;
+            if (alignment > 1U) {
+                start = (start + alignment - 1U) / alignment * alignment;
+            }
+            verify(start + num_bytes <= capacity_, "RegionBuf: region too small");
+            if (start != size_) {
+                std::memset(data_ + size_, 0, start - size_);
+            }
+            if (num_bytes != 0U) {
+                std::memcpy(data_ + start, ptr, num_bytes);
+            }
+            size_ = start + num_bytes;
+            return static_cast<offset_t>(start);
+        }
+
+        datapod::usize size() const noexcept { return size_; }
+
+        datapod::u8 *data_;
+        datapod::usize capacity_;
+        datapod::usize size_{0U};
     };
 
     // Deduction guide
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "datapod/core/mode.hpp"
+#include "datapod/core/verify.hpp"
+#include "datapod/pods/adapters/optional.hpp"
+#include "datapod/pods/lockfree/byte_ring.hpp"
+#include "datapod/serialization/buf.hpp"
+#include "datapod/serialization/serialize.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Serializing through a ByteRing
+    // =============================================================================
+    //
+    // serialize() followed by ByteRing::try_push() encodes into a ByteBuf and copies it again into
+    // the ring. These encode straight into a ring reservation instead and decode from the record in
+    // place, so a message crosses the ring (or the shared memory behind it) without a staging copy.
+
+    // Encode el into the next record; false when the ring has no room for it right now
+    // The encoding is sized exactly up front, so the reservation is never too small.
+    template <Mode M = Mode::NONE, typename Policy, typename T> bool serialize_to_ring(ByteRing<Policy> &ring, T &el) {
+        auto const size = serialized_size_of<M>(el);
+        verify(size <= ring.max_record(), "serialize_to_ring: message larger than the ring's max_record()");
+
+        auto res = ring.reserve(size);
+        if (!res) {
+            return false;
+        }
+        try {
+            auto target = RegionBuf{res.data, res.size};
+            serialize_to<M>(target, el);
+        } catch (...) {
+            ring.cancel(res);
+            throw;
+        }
+        ring.commit(res);
+        return true;
+    }
+
+    // Decode and consume the next record; empty while none is ready
+    // A record that fails to decode is consumed anyway, so one bad message cannot stall the ring.
+    template <Mode M = Mode::NONE, typename T, typename Policy> Optional<T> deserialize_from_ring(ByteRing<Policy> &ring) {
+        auto rec = ring.peek();
+        if (!rec) {
+            return nullopt;
+        }
+        try {
+            Optional<T> out{deserialize<M, T>(rec.data, rec.size)};
+            ring.consume();
+            return out;
+        } catch (...) {
+            ring.consume();
+            throw;
+        }
+    }
+
+} // namespace datapod
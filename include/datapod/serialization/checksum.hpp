@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "datapod/core/hash.hpp"
+#include "datapod/core/mode.hpp"
+#include "datapod/pods/sequential/vector.hpp"
+#include "datapod/serialization/buf.hpp"
+#include "datapod/serialization/parallel.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Block checksums
+    // =============================================================================
+    //
+    // The WITH_INTEGRITY checksum tells whether a buffer is intact, not where it is damaged, and
+    // it has to be computed front to back. Block checksums hash fixed-size blocks independently:
+    // a mismatch names the corrupted blocks (e.g. to re-request only those over a link), and the
+    // blocks are hashed on an executor, so a multi-GB snapshot verifies at memory bandwidth.
+    // The table is an ordinary aggregate; store or send it next to the buffer it describes.
+
+    constexpr datapod::usize CHECKSUM_BLOCK_BYTES = 1024U * 1024U;
+
+    struct BlockChecksums {
+        datapod::usize block_size = CHECKSUM_BLOCK_BYTES;
+        datapod::usize size = 0U; // Bytes covered
+        Vector<hash_t> sums;
+    };
+
+    // Hash every block_size bytes of [data, data + size) on the executor
+    template <Mode M = Mode::NONE, typename Executor>
+    BlockChecksums block_checksums(datapod::u8 const *data, datapod::usize const size, datapod::usize const block_size,
+                                   Executor &&executor) {
+        verify(block_size != 0U, "block_checksums: block size must be non-zero");
+        auto result = BlockChecksums{block_size, size, {}};
+        result.sums.resize((size + block_size - 1U) / block_size);
+        executor(result.sums.size(), [&](datapod::usize const b) {
+            auto const begin = b * block_size;
+            result.sums[b] = integrity_checksum<M>(data + begin, std::min(block_size, size - begin));
+        });
+        return result;
+    }
+
+    template <Mode M = Mode::NONE>
+    BlockChecksums block_checksums(ByteBuf const &buf, datapod::usize const block_size = CHECKSUM_BLOCK_BYTES) {
+        return block_checksums<M>(buf.data(), buf.size(), block_size, ThreadExecutor{});
+    }
+
+    // Indices of the blocks that do not match, in ascending order
+    // Blocks missing from a truncated buffer, or past the end of the table, count as corrupted.
+    template <Mode M = Mode::NONE, typename Executor>
+    Vector<datapod::usize> corrupted_blocks(datapod::u8 const *data, datapod::usize const size,
+                                            BlockChecksums const &expected, Executor &&executor) {
+        auto const actual = block_checksums<M>(data, size, expected.block_size, executor);
+
+        // A short last block only matches a last block of the same length
+        auto const block_length = [&](datapod::usize const b, datapod::usize const total) {
+            auto const begin = b * expected.block_size;
+            return begin < total ? std::min(expected.block_size, total - begin) : 0U;
+        };
+
+        Vector<datapod::usize> corrupted;
+        auto const n = std::max(actual.sums.size(), expected.sums.size());
+        for (datapod::usize b = 0U; b < n; ++b) {
+            auto const ok = b < actual.sums.size() && b < expected.sums.size() &&
+                            actual.sums[b] == expected.sums[b] && block_length(b, size) == block_length(b, expected.size);
+            if (!ok) {
+                corrupted.push_back(b);
+            }
+        }
+        return corrupted;
+    }
+
+    template <Mode M = Mode::NONE>
+    Vector<datapod::usize> corrupted_blocks(ByteBuf const &buf, BlockChecksums const &expected) {
+        return corrupted_blocks<M>(buf.data(), buf.size(), expected, ThreadExecutor{});
+    }
+
+} // namespace datapod
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "datapod/core/endian.hpp"
+#include "datapod/core/mode.hpp"
+#include "datapod/core/verify.hpp"
+#include "datapod/serialization/buf.hpp"
+#include "datapod/serialization/serialize.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Delta serialization
+    // =============================================================================
+    //
+    // serialize_delta() encodes only what changed between a baseline and the current value, and
+    // apply_delta() patches the baseline into the current value in place. The walk follows
+    // serialize(), and every node starts with a one-byte tag:
+    //   UNCHANGED  nothing follows
+    //   REPLACED   the full serialize<M>() encoding of the new value
+    //   FIELDS     one node per reflected field
+    //   ELEMENTS   [usize size], one node per common element, full encodings for appended ones
+    //   CHUNKS     [usize size][usize chunk][usize runs], runs x ([usize first][usize count][bytes])
+    // Vectors and Arrays of flat elements are compared chunk by chunk with memcmp, so a grid with
+    // 1% of its cells changed costs about 1% of its full encoding. Strings, maps and the other
+    // containers are replaced whole when they differ.
+    //
+    // A delta only makes sense against the exact baseline it was computed from.
+
+    constexpr datapod::usize DELTA_CHUNK_BYTES = 256U;
+
+    namespace detail {
+        enum class DeltaTag : datapod::u8 { UNCHANGED = 0U, REPLACED = 1U, FIELDS = 2U, ELEMENTS = 3U, CHUNKS = 4U };
+
+        template <typename T> struct delta_vector : std::false_type {};
+        template <typename T> struct delta_vector<Vector<T>> : std::true_type {};
+
+        template <typename T> constexpr bool delta_by_fields() noexcept {
+            return std::is_class_v<T> && !is_container_v<T> && to_tuple_works_v<T> && !is_flat_v<T>;
+        }
+
+        template <Mode M> struct DeltaEncoder {
+            // Encode prev -> cur; an equal pair collapses to a single UNCHANGED tag
+            template <typename T> bool node(T const &prev, T const &cur) {
+                auto const mark = static_cast<offset_t>(buf_.size());
+                if (changes(prev, cur)) {
+                    return true;
+                }
+                buf_.truncate(mark);
+                put(DeltaTag::UNCHANGED);
+                return false;
+            }
+
+            Buf<ByteBuf> &buf_;
+            SerializationContext<Buf<ByteBuf>, M> ctx_;
+            datapod::usize chunk_bytes_;
+
+          private:
+            template <typename T> bool changes(T const &prev, T const &cur) {
+                if constexpr (std::is_scalar_v<T> || is_flat_v<T>) {
+                    // Flat values have no padding, so byte equality is value equality
+                    return std::memcmp(&prev, &cur, sizeof(T)) != 0 && replace(cur);
+                } else if constexpr (std::is_same_v<T, String>) {
+                    return prev.view() != cur.view() && replace(cur);
+                } else if constexpr (delta_vector<T>::value) {
+                    return span(prev.data(), prev.size(), cur.data(), cur.size());
+                } else if constexpr (flat_array<T>::value) {
+                    return span(prev.data(), flat_array<T>::extent, cur.data(), flat_array<T>::extent);
+                } else if constexpr (std::is_array_v<T>) {
+                    return span(&prev[0], std::extent_v<T>, &cur[0], std::extent_v<T>);
+                } else if constexpr (delta_by_fields<T>()) {
+                    put(DeltaTag::FIELDS);
+                    auto p = to_tuple(const_cast<T &>(prev));
+                    auto c = to_tuple(const_cast<T &>(cur));
+                    return [&]<datapod::usize... Is>(std::index_sequence<Is...>) {
+                        return (false | ... | node(std::get<Is>(p), std::get<Is>(c)));
+                    }(std::make_index_sequence<std::tuple_size_v<decltype(p)>>{});
+                } else {
+                    return encode(prev) != encode(cur) && replace(cur);
+                }
+            }
+
+            template <typename E> bool span(E const *prev, datapod::usize prev_n, E const *cur, datapod::usize n) {
+                if constexpr (is_bulk_copyable_v<M, E>) {
+                    if (n != 0U && has_flat_layout(const_cast<E &>(cur[0]))) {
+                        return chunks(prev, prev_n, cur, n);
+                    }
+                }
+
+                put(DeltaTag::ELEMENTS);
+                serialize<M>(ctx_, n);
+                auto changed = prev_n != n;
+                auto const common = std::min(prev_n, n);
+                for (datapod::usize i = 0U; i < common; ++i) {
+                    changed = node(prev[i], cur[i]) || changed;
+                }
+                serialize_span<M>(ctx_, const_cast<E *>(cur) + common, n - common);
+                return changed;
+            }
+
+            // Coalesce runs of changed chunks; each run is [first chunk][chunk count][elements]
+            template <typename E> bool chunks(E const *prev, datapod::usize prev_n, E const *cur, datapod::usize n) {
+                auto chunk = std::max<datapod::usize>(1U, chunk_bytes_ / sizeof(E));
+                auto const dirty = [&](datapod::usize const c) {
+                    auto const begin = c * chunk;
+                    auto const len = std::min(chunk, n - begin);
+                    return begin + len > prev_n || std::memcmp(prev + begin, cur + begin, len * sizeof(E)) != 0;
+                };
+
+                // Runs are found first: the run count precedes them and may be a varint
+                std::vector<Pair<datapod::usize, datapod::usize>> runs;
+                auto const num_chunks = (n + chunk - 1U) / chunk;
+                for (datapod::usize c = 0U; c < num_chunks; ++c) {
+                    if (!dirty(c)) {
+                        continue;
+                    }
+                    auto const first = c;
+                    while (c + 1U < num_chunks && dirty(c + 1U)) {
+                        ++c;
+                    }
+                    runs.push_back({first, c + 1U - first});
+                }
+
+                put(DeltaTag::CHUNKS);
+                serialize<M>(ctx_, n);
+                serialize<M>(ctx_, chunk);
+                auto num_runs = runs.size();
+                serialize<M>(ctx_, num_runs);
+                for (auto &run : runs) {
+                    serialize<M>(ctx_, run.first);
+                    serialize<M>(ctx_, run.second);
+                    auto const begin = run.first * chunk;
+                    serialize_span<M>(ctx_, const_cast<E *>(cur) + begin, std::min(run.second * chunk, n - begin));
+                }
+                return !runs.empty() || prev_n != n;
+            }
+
+            template <typename T> bool replace(T const &cur) {
+                put(DeltaTag::REPLACED);
+                serialize<M>(ctx_, const_cast<T &>(cur));
+                return true;
+            }
+
+            template <typename T> static ByteBuf encode(T const &value) {
+                auto b = Buf{};
+                auto ctx = SerializationContext<Buf<ByteBuf>, M>{b};
+                serialize<M>(ctx, const_cast<T &>(value));
+                return b.release();
+            }
+
+            void put(DeltaTag const tag) {
+                auto t = static_cast<datapod::u8>(tag);
+                serialize<M>(ctx_, t);
+            }
+        };
+
+        template <Mode M> struct DeltaDecoder {
+            template <typename T> void node(T &value) {
+                auto const tag = take();
+                if (tag == DeltaTag::UNCHANGED) {
+                    return;
+                }
+                if (tag == DeltaTag::REPLACED) {
+                    deserialize<M>(ctx_, value);
+                    return;
+                }
+
+                if constexpr (delta_vector<T>::value) {
+                    auto const prev_n = value.size();
+                    auto const n = size();
+                    value.resize(n);
+                    span(tag, value.data(), prev_n, n);
+                } else if constexpr (flat_array<T>::value) {
+                    verify(size() == flat_array<T>::extent, "delta: array size mismatch");
+                    span(tag, value.data(), flat_array<T>::extent, flat_array<T>::extent);
+                } else if constexpr (std::is_array_v<T>) {
+                    verify(size() == std::extent_v<T>, "delta: array size mismatch");
+                    span(tag, &value[0], std::extent_v<T>, std::extent_v<T>);
+                } else if constexpr (delta_by_fields<T>()) {
+                    verify(tag == DeltaTag::FIELDS, "delta: malformed node");
+                    for_each_field(value, [&](auto &field) { node(field); });
+                } else {
+                    verify(false, "delta: malformed node");
+                }
+            }
+
+            DeserializationContext<M> &ctx_;
+
+          private:
+            template <typename E> void span(DeltaTag const tag, E *data, datapod::usize prev_n, datapod::usize n) {
+                if (tag == DeltaTag::ELEMENTS) {
+                    auto const common = std::min(prev_n, n);
+                    for (datapod::usize i = 0U; i < common; ++i) {
+                        node(data[i]);
+                    }
+                    deserialize_span<M>(ctx_, data + common, n - common);
+                    return;
+                }
+
+                verify(tag == DeltaTag::CHUNKS, "delta: malformed node");
+                auto const chunk = size();
+                auto const runs = size();
+                verify(chunk != 0U, "delta: malformed chunk size");
+                for (datapod::usize r = 0U; r < runs; ++r) {
+                    auto const first = size();
+                    auto const count = size();
+                    verify(first < (n + chunk - 1U) / chunk && count != 0U, "delta: chunk out of range");
+                    auto const begin = first * chunk;
+                    auto const len = std::min(count * chunk, n - begin);
+                    deserialize_span<M>(ctx_, data + begin, len);
+                }
+            }
+
+            DeltaTag take() {
+                datapod::u8 t = 0U;
+                deserialize<M>(ctx_, t);
+                verify(t <= static_cast<datapod::u8>(DeltaTag::CHUNKS), "delta: unknown node tag");
+                return static_cast<DeltaTag>(t);
+            }
+
+            datapod::usize size() {
+                datapod::usize n = 0U;
+                deserialize<M>(ctx_, n);
+                return n;
+            }
+        };
+    } // namespace detail
+
+    // Encode the changes that turn baseline into current
+    template <Mode M = Mode::NONE, typename T>
+    ByteBuf serialize_delta(T const &baseline, T const &current,
+                            datapod::usize const chunk_bytes = DELTA_CHUNK_BYTES) {
+        auto b = Buf{};
+        auto ctx = SerializationContext<Buf<ByteBuf>, M>{b};
+
+        // Write integrity checksum placeholder if requested
+        offset_t integrity_offset = 0;
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            hash_t placeholder = 0;
+            integrity_offset = ctx.write(&placeholder, sizeof(hash_t), alignof(hash_t));
+        }
+
+        // Write version hash if requested
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            auto const h = convert_endian<M>(type_hash<decay_t<T>>());
+            ctx.write(&h, sizeof(h), alignof(hash_t));
+        }
+
+        detail::DeltaEncoder<M>{b, ctx, chunk_bytes}.node(baseline, current);
+
+        // Calculate and write integrity checksum
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            auto const checksum_start = integrity_offset + static_cast<offset_t>(sizeof(hash_t));
+            ctx.write(static_cast<datapod::usize>(integrity_offset),
+                      convert_endian<M>(b.template checksum<M>(checksum_start)));
+        }
+        return b.release();
+    }
+
+    // Delta against a baseline that is only available in its serialize<M>() form
+    template <Mode M = Mode::NONE, typename T>
+    ByteBuf serialize_delta(ByteBuf const &baseline, T const &current,
+                            datapod::usize const chunk_bytes = DELTA_CHUNK_BYTES) {
+        return serialize_delta<M>(deserialize<M, T>(baseline), current, chunk_bytes);
+    }
+
+    // Patch baseline in place into the value the delta was computed for
+    template <Mode M = Mode::NONE, typename T>
+    void apply_delta(T &baseline, datapod::u8 const *data, datapod::usize size) {
+        auto ctx = DeserializationContext<M>{data, size};
+
+        // Verify integrity checksum if present
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            hash_t stored_checksum;
+            ctx.align(alignof(hash_t));
+            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
+            ctx.read(&stored_checksum, sizeof(hash_t));
+            auto const calculated_checksum = integrity_checksum<M>(data + checksum_start, size - checksum_start);
+            verify(convert_endian<M>(stored_checksum) == calculated_checksum, "integrity check failed: data corrupted");
+        }
+
+        // Verify version hash if present
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            hash_t stored_hash;
+            ctx.align(alignof(hash_t));
+            ctx.read(&stored_hash, sizeof(hash_t));
+            auto const expected_hash = type_hash<decay_t<T>>();
+            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
+        }
+
+        detail::DeltaDecoder<M>{ctx}.node(baseline);
+        verify(ctx.pos_ == size, "delta: trailing bytes");
+    }
+
+    template <Mode M = Mode::NONE, typename T> void apply_delta(T &baseline, ByteBuf const &delta) {
+        apply_delta<M>(baseline, delta.data(), delta.size());
+    }
+
+} // namespace datapod
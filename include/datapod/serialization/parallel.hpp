@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "datapod/core/mode.hpp"
+#include "datapod/core/verify.hpp"
+#include "datapod/serialization/buf.hpp"
+#include "datapod/serialization/serialize.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Parallel serialization
+    // =============================================================================
+    //
+    // serialize_parallel() and deserialize_parallel() produce and consume exactly the bytes of
+    // serialize() and deserialize(), so the two can be mixed freely. The structure (sizes, headers,
+    // strings, map entries) is still walked on the calling thread. What gets spread over workers
+    // is the payload of every flat span of at least PARALLEL_MIN_BYTES: Vector<float> data,
+    // MultiSeries columns, the inner buffers of a Vector<Vector<Point>>. Their destination offsets
+    // are known up front (serialized_size_of() pre-sizes the buffer), so the copies fill disjoint
+    // regions, batched into PARALLEL_GRAIN_BYTES tasks.
+    //
+    // An executor is any callable ex(n, task) that runs task(i) for every i in [0, n) and returns
+    // once all of them have finished; a thread pool's parallel-for fits directly. ThreadExecutor
+    // is the default and runs each call on a set of std::jthread workers.
+
+    constexpr datapod::usize PARALLEL_MIN_BYTES = 4U * 1024U;
+    constexpr datapod::usize PARALLEL_GRAIN_BYTES = 256U * 1024U;
+
+    // Executor spawning up to `workers` std::jthreads per call (the caller's thread is one of them)
+    struct ThreadExecutor {
+        explicit ThreadExecutor(datapod::usize const workers = std::max(1U, std::thread::hardware_concurrency()))
+            : workers_{std::max<datapod::usize>(1U, workers)} {}
+
+        template <typename Task> void operator()(datapod::usize const n, Task const &task) const {
+            std::atomic<datapod::usize> next{0U};
+            auto const work = [&] {
+                for (auto i = next.fetch_add(1U); i < n; i = next.fetch_add(1U)) {
+                    task(i);
+                }
+            };
+
+            std::vector<std::jthread> threads;
+            for (datapod::usize t = 1U; t < std::min(workers_, n); ++t) {
+                threads.emplace_back(work);
+            }
+            work();
+        }
+
+        datapod::usize workers_;
+    };
+
+    namespace detail {
+        // Bulk copies deferred until the structural walk is done
+        struct CopyPlan {
+            struct Copy {
+                datapod::u8 *dst_;
+                datapod::u8 const *src_;
+                datapod::usize n_;
+            };
+
+            void add(void *dst, void const *src, datapod::usize n) {
+                auto *d = static_cast<datapod::u8 *>(dst);
+                auto const *s = static_cast<datapod::u8 const *>(src);
+                for (; n > PARALLEL_GRAIN_BYTES; d += PARALLEL_GRAIN_BYTES, s += PARALLEL_GRAIN_BYTES) {
+                    copies_.push_back({d, s, PARALLEL_GRAIN_BYTES});
+                    n -= PARALLEL_GRAIN_BYTES;
+                }
+                copies_.push_back({d, s, n});
+            }
+
+            // Group consecutive copies into ~PARALLEL_GRAIN_BYTES batches and run them
+            template <typename Executor> void run(Executor &executor) {
+                if (copies_.empty()) {
+                    return;
+                }
+                std::vector<datapod::usize> batches{0U};
+                datapod::usize bytes = 0U;
+                for (datapod::usize i = 0U; i != copies_.size(); ++i) {
+                    if (bytes >= PARALLEL_GRAIN_BYTES) {
+                        batches.push_back(i);
+                        bytes = 0U;
+                    }
+                    bytes += copies_[i].n_;
+                }
+                batches.push_back(copies_.size());
+
+                executor(batches.size() - 1U, [&](datapod::usize const b) {
+                    for (auto i = batches[b]; i != batches[b + 1U]; ++i) {
+                        std::memcpy(copies_[i].dst_, copies_[i].src_, copies_[i].n_);
+                    }
+                });
+                copies_.clear();
+            }
+
+            std::vector<Copy> copies_;
+        };
+
+        template <typename T> struct parallel_vector : std::false_type {};
+        template <typename E> struct parallel_vector<Vector<E>> : std::true_type {};
+
+        template <typename T> struct parallel_pair : std::false_type {};
+        template <typename A, typename B> struct parallel_pair<Pair<A, B>> : std::true_type {};
+
+        template <typename T> struct parallel_optional : std::false_type {};
+        template <typename T> struct parallel_optional<Optional<T>> : std::true_type {};
+
+        template <typename T> struct parallel_map : std::false_type {};
+        template <typename K, typename V, template <typename> typename Ptr, typename GetValue, typename Hash,
+                  typename Eq>
+        struct parallel_map<HashStorage<Pair<K, V>, Ptr, GetFirst, GetValue, Hash, Eq>> : std::true_type {
+            using entry_type = Pair<K, V>;
+            using mapped_type = V;
+        };
+
+        template <Mode M> struct ParallelReader {
+            // Decode value, deferring flat payloads whose destination stays put until the copies run
+            // Vector buffers survive moves, so a map's Vector values may be deferred even though
+            // entries are decoded into a temporary; in-object arrays only when `stable` is set.
+            template <typename T> void plan(T &value, bool const stable) {
+                if constexpr (parallel_vector<T>::value) {
+                    datapod::usize n = 0U;
+                    deserialize<M>(ctx_, n);
+                    check_length<typename T::value_type>(ctx_, n);
+                    value.resize(n);
+                    span(value.data(), n, true);
+                } else if constexpr (flat_array<T>::value) {
+                    span(value.data(), flat_array<T>::extent, stable);
+                } else if constexpr (parallel_pair<T>::value) {
+                    plan(value.first, stable);
+                    plan(value.second, stable);
+                } else if constexpr (parallel_map<T>::value) {
+                    datapod::usize n = 0U;
+                    deserialize<M>(ctx_, n);
+                    check_length<typename parallel_map<T>::entry_type>(ctx_, n);
+                    value.clear();
+                    for (datapod::usize i = 0U; i < n; ++i) {
+                        typename parallel_map<T>::entry_type entry;
+                        deserialize<M>(ctx_, entry.first); // Hashed on insert, so decoded now
+                        if constexpr (parallel_vector<typename parallel_map<T>::mapped_type>::value) {
+                            plan(entry.second, false);
+                        } else {
+                            deserialize<M>(ctx_, entry.second);
+                        }
+                        verify(value.emplace(std::move(entry)).second, "deserialization: duplicate map key");
+                    }
+                } else if constexpr (std::is_class_v<T> && !is_container_v<T> && to_tuple_works_v<T> &&
+                                     !is_flat_v<T>) {
+                    for_each_field(value, [&](auto &field) { plan(field, stable); });
+                } else {
+                    deserialize<M>(ctx_, value);
+                }
+            }
+
+            DeserializationContext<M> &ctx_;
+            CopyPlan &plan_;
+
+          private:
+            template <typename E> void span(E *data, datapod::usize const n, bool const stable) {
+                if constexpr (is_bulk_copyable_v<M, E>) {
+                    if (n != 0U && has_flat_layout(data[0])) {
+                        auto const bytes = n * sizeof(E);
+                        if (!stable || bytes < PARALLEL_MIN_BYTES) {
+                            deserialize_span<M>(ctx_, data, n);
+                            return;
+                        }
+                        ctx_.align(alignof(E));
+                        verify(ctx_.pos_ + bytes <= ctx_.size_, "deserialization: out of bounds read");
+                        plan_.add(data, ctx_.data_ + ctx_.pos_, bytes);
+                        ctx_.pos_ += bytes;
+                        return;
+                    }
+                }
+                for (datapod::usize i = 0U; i < n; ++i) {
+                    plan(data[i], stable);
+                }
+            }
+        };
+
+        // Flat payloads of at least PARALLEL_MIN_BYTES reachable from the value being serialized
+        // These stay put for the whole serialize_to() call, so copies out of them may be deferred.
+        struct StableSpans {
+            template <Mode M, typename T> void collect(T &value) {
+                if constexpr (parallel_vector<T>::value) {
+                    span<M>(value.data(), value.size());
+                } else if constexpr (flat_array<T>::value) {
+                    span<M>(value.data(), flat_array<T>::extent);
+                } else if constexpr (parallel_pair<T>::value) {
+                    collect<M>(value.first);
+                    collect<M>(value.second);
+                } else if constexpr (parallel_optional<T>::value) {
+                    if (value.has_value()) {
+                        collect<M>(*value);
+                    }
+                } else if constexpr (parallel_map<T>::value) {
+                    for (auto &entry : value) {
+                        collect<M>(const_cast<typename parallel_map<T>::entry_type &>(entry));
+                    }
+                } else if constexpr (std::is_class_v<T> && !is_container_v<T> && to_tuple_works_v<T> &&
+                                     !is_flat_v<T>) {
+                    for_each_field(value, [&](auto &field) { collect<M>(field); });
+                }
+            }
+
+            // Sort once everything is collected, before the first contains()
+            void seal() {
+                std::sort(spans_.begin(), spans_.end(),
+                          [](Span const &a, Span const &b) { return std::less<>{}(a.data_, b.data_); });
+            }
+
+            bool contains(void const *ptr, datapod::usize const n) const {
+                auto const *p = static_cast<datapod::u8 const *>(ptr);
+                auto const it = std::upper_bound(spans_.begin(), spans_.end(), p, [](auto const *q, Span const &s) {
+                    return std::less<>{}(q, s.data_);
+                });
+                return it != spans_.begin() && std::less_equal<>{}(p + n, std::prev(it)->data_ + std::prev(it)->n_);
+            }
+
+          private:
+            struct Span {
+                datapod::u8 const *data_;
+                datapod::usize n_;
+            };
+
+            template <Mode M, typename E> void span(E *data, datapod::usize const n) {
+                if constexpr (is_bulk_copyable_v<M, E>) {
+                    if (n != 0U && has_flat_layout(data[0])) {
+                        if (n * sizeof(E) >= PARALLEL_MIN_BYTES) {
+                            spans_.push_back({reinterpret_cast<datapod::u8 const *>(data), n * sizeof(E)});
+                        }
+                        return;
+                    }
+                }
+                for (datapod::usize i = 0U; i < n; ++i) {
+                    collect<M>(data[i]);
+                }
+            }
+
+            std::vector<Span> spans_;
+        };
+    } // namespace detail
+
+    // Serialization target filling a pre-sized buffer, large writes deferred to the executor
+    // Only writes out of the payloads registered with defer_payloads_of() are deferred, so those
+    // must stay unchanged until flush(). Anything else, such as a temporary built by a custom
+    // serialize() overload, is copied before write() returns.
+    template <typename Executor> struct ParallelBuf {
+        ParallelBuf(Executor &executor, datapod::usize const size) : executor_{executor} { buf_.allocate(size); }
+
+        ParallelBuf(ParallelBuf const &) = delete;
+        ParallelBuf &operator=(ParallelBuf const &) = delete;
+
+        // Let the large flat payloads of el be copied on the executor; el stays untouched until flush()
+        template <Mode M, typename T> void defer_payloads_of(T &el) {
+            stable_.collect<M>(el);
+            stable_.seal();
+        }
+
+        // Write raw data with optional alignment (relative to the buffer start)
+        offset_t write(void const *ptr, datapod::usize const num_bytes, datapod::usize alignment = 0U) {
+            auto start = buf_.size_;
+            if (alignment > 1U) {
+                start = (start + alignment - 1U) / alignment * alignment;
+            }
+
+            // Deferred copies point into the buffer, so it must never reallocate
+            verify(start + num_bytes <= buf_.buf_.size(), "ParallelBuf: write past the pre-sized buffer");
+            if (num_bytes >= PARALLEL_MIN_BYTES && stable_.contains(ptr, num_bytes)) {
+                plan_.add(buf_.addr(static_cast<offset_t>(start)), ptr, num_bytes);
+            } else if (num_bytes != 0U) {
+                std::memcpy(buf_.addr(static_cast<offset_t>(start)), ptr, num_bytes);
+            }
+            buf_.size_ = start + num_bytes;
+
+            return static_cast<offset_t>(start);
+        }
+
+        // Write a value at a specific position
+        template <typename T> void write(datapod::usize const pos, T const &val) { buf_.write(pos, val); }
+
+        // Checksum from the given offset; pending copies land first
+        template <Mode M = Mode::NONE> datapod::u64 checksum(offset_t const start = 0U) {
+            flush();
+            return buf_.template checksum<M>(start);
+        }
+
+        // Run all deferred copies
+        void flush() { plan_.run(executor_); }
+
+        datapod::usize size() const noexcept { return buf_.size(); }
+
+        ByteBuf release() {
+            flush();
+            return buf_.release();
+        }
+
+      private:
+        Executor &executor_;
+        Buf<ByteBuf> buf_;
+        detail::CopyPlan plan_;
+        detail::StableSpans stable_;
+    };
+
+    // Encode el with its large flat payloads copied on the executor; byte-identical to serialize()
+    template <Mode M = Mode::NONE, typename T, typename Executor> ByteBuf serialize_parallel(T &el, Executor &&executor) {
+        auto b = ParallelBuf<std::remove_reference_t<Executor>>{executor, serialized_size_of<M>(el)};
+        b.template defer_payloads_of<M>(el);
+        serialize_to<M>(b, el);
+        return b.release();
+    }
+
+    template <Mode M = Mode::NONE, typename T> ByteBuf serialize_parallel(T &el) {
+        return serialize_parallel<M>(el, ThreadExecutor{});
+    }
+
+    // Decode a serialize() buffer with its large flat payloads copied on the executor
+    template <Mode M = Mode::NONE, typename T, typename Executor>
+    T deserialize_parallel(datapod::u8 const *data, datapod::usize size, Executor &&executor) {
+        T result{};
+        auto ctx = DeserializationContext<M>{data, size};
+
+        // Verify integrity checksum if present
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            hash_t stored_checksum;
+            ctx.align(alignof(hash_t));
+            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
+            ctx.read(&stored_checksum, sizeof(hash_t));
+            auto const calculated_checksum = integrity_checksum<M>(data + checksum_start, size - checksum_start);
+            verify(convert_endian<M>(stored_checksum) == calculated_checksum, "integrity check failed: data corrupted");
+        }
+
+        // Verify version hash if present
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            hash_t stored_hash;
+            ctx.align(alignof(hash_t));
+            ctx.read(&stored_hash, sizeof(hash_t));
+            auto const expected_hash = type_hash<decay_t<T>>();
+            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
+        }
+
+        auto plan = detail::CopyPlan{};
+        detail::ParallelReader<M>{ctx, plan}.plan(result, true);
+        plan.run(executor);
+        return result;
+    }
+
+    template <Mode M = Mode::NONE, typename T, typename Executor>
+    T deserialize_parallel(ByteBuf const &buf, Executor &&executor) {
+        return deserialize_parallel<M, T>(buf.data(), buf.size(), executor);
+    }
+
+    template <Mode M = Mode::NONE, typename T> T deserialize_parallel(ByteBuf const &buf) {
+        return deserialize_parallel<M, T>(buf.data(), buf.size(), ThreadExecutor{});
+    }
+
+} // namespace datapod
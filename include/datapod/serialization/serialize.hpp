@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <string_view>
 #include <type_traits>
 
 #include "datapod/core/endian.hpp"
 #include "datapod/core/equal_to.hpp"
 #include "datapod/core/mode.hpp"
+#include "datapod/core/varint.hpp"
 #include "datapod/core/verify.hpp"
 #include "datapod/pods/adapters/optional.hpp"
 #include "datapod/pods/adapters/pair.hpp"
@@ -38,9 +41,9 @@ namespace datapod {
 
         explicit SerializationContext(Target &t) : target_{t} {}
 
-        // Write raw data to target
+        // Write raw data to target (Mode::COMPACT packs everything, so alignment is dropped)
         offset_t write(void const *ptr, datapod::usize const size, datapod::usize const alignment = 0) {
-            return target_.write(ptr, size, alignment);
+            return target_.write(ptr, size, is_mode_enabled(M, Mode::COMPACT) ? 0U : alignment);
         }
 
         // Write value at position
@@ -55,10 +58,70 @@ namespace datapod {
     // Serialize Implementation
     // =============================================================================
 
+    // =============================================================================
+    // Compact Encoding
+    // =============================================================================
+
+    // Under Mode::COMPACT every integer and enum wider than a byte (lengths, sizes and variant
+    // indices included) is written as a LEB128 varint, zigzagged when signed, and nothing is
+    // padded for alignment. Floats, bools and single bytes keep their fixed width.
+    namespace detail {
+        template <typename T> constexpr bool is_varint() noexcept {
+            if constexpr (std::is_enum_v<T>) {
+                return sizeof(T) > 1U;
+            } else {
+                return std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) > 1U;
+            }
+        }
+
+        template <typename T> constexpr datapod::u64 to_varint(T const value) noexcept {
+            if constexpr (std::is_enum_v<T>) {
+                return to_varint(static_cast<std::underlying_type_t<T>>(value));
+            } else if constexpr (std::is_signed_v<T>) {
+                return zigzag_encode(value);
+            } else {
+                return value;
+            }
+        }
+
+        template <typename T> T from_varint(datapod::u64 const bits) {
+            if constexpr (std::is_enum_v<T>) {
+                return static_cast<T>(from_varint<std::underlying_type_t<T>>(bits));
+            } else {
+                using U = std::make_unsigned_t<T>;
+                verify(bits <= static_cast<U>(~U{0}), "deserialization: varint out of range");
+                if constexpr (std::is_signed_v<T>) {
+                    return zigzag_decode<T>(static_cast<U>(bits));
+                } else {
+                    return static_cast<T>(bits);
+                }
+            }
+        }
+
+        template <typename Ctx> void write_varint(Ctx &ctx, datapod::u64 const v) {
+            if constexpr (std::is_same_v<decltype(ctx.target_), SizeCounter &>) {
+                ctx.write(nullptr, varint_size(v), 0U); // serialized_size_of() only counts
+            } else if (v < 0x80U) {
+                auto const byte = static_cast<datapod::u8>(v); // Most lengths and small integers
+                ctx.write(&byte, 1U, 0U);
+            } else {
+                datapod::u8 bytes[VARINT_MAX_BYTES];
+                ctx.write(bytes, varint_encode(v, bytes), 0U);
+            }
+        }
+    } // namespace detail
+
+    template <Mode M, typename T>
+    inline constexpr bool is_varint_encoded_v = is_mode_enabled(M, Mode::COMPACT) && detail::is_varint<T>();
+
     // Serialize scalar types (int, float, etc.)
     template <Mode M, typename Ctx, typename T> std::enable_if_t<std::is_scalar_v<T>> serialize(Ctx &ctx, T &value) {
-        auto const converted = convert_endian<M>(value);
-        ctx.write(&converted, sizeof(T), alignof(T));
+        if constexpr (is_varint_encoded_v<M, T>) {
+            detail::write_varint(ctx, detail::to_varint(value));
+        } else {
+            auto const converted = convert_endian<M>(value);
+            ctx.write(&converted, sizeof(T), alignof(T));
+        }
     }
 
     // Helper to detect our container types
@@ -91,6 +154,120 @@ namespace datapod {
     struct is_container<mat::Tensor<T, Dims...>> : std::true_type {};
     template <typename T> constexpr bool is_container_v = is_container<decay_t<T>>::value;
 
+    // =============================================================================
+    // Flat Layout Detection (bulk copy fast path)
+    // =============================================================================
+
+    // A type is "flat" when serializing it field by field yields exactly its in-memory bytes:
+    // trivially copyable, arithmetic/enum leaves only, no padding and no alignment step before
+    // the first leaf. Runs of flat elements are copied with one memcpy in each direction.
+    namespace detail {
+        template <typename T> struct flat_array : std::false_type {};
+        template <typename T, datapod::usize N> struct flat_array<Array<T, N>> : std::true_type {
+            using element_type = T;
+            static constexpr datapod::usize extent = N;
+        };
+
+        template <typename T> constexpr bool is_flat() noexcept;
+
+        template <typename T, typename Fields, datapod::usize... Is>
+        constexpr bool is_flat_fields(std::index_sequence<Is...>) noexcept {
+            if constexpr (sizeof...(Is) == 0U) {
+                return false;
+            } else {
+                using First = std::remove_cvref_t<std::tuple_element_t<0U, Fields>>;
+                return (is_flat<std::remove_cvref_t<std::tuple_element_t<Is, Fields>>>() && ...) &&
+                       (sizeof(std::remove_cvref_t<std::tuple_element_t<Is, Fields>>) + ...) == sizeof(T) &&
+                       alignof(First) == alignof(T);
+            }
+        }
+
+        template <typename T> constexpr bool is_flat() noexcept {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+                return true;
+            } else if constexpr (std::is_array_v<T>) {
+                return is_flat<std::remove_cv_t<std::remove_extent_t<T>>>();
+            } else if constexpr (!std::is_class_v<T> || !std::is_trivially_copyable_v<T>) {
+                return false;
+            } else if constexpr (flat_array<T>::value) {
+                using E = typename flat_array<T>::element_type;
+                return flat_array<T>::extent != 0U && is_flat<E>() && sizeof(T) == flat_array<T>::extent * sizeof(E);
+            } else if constexpr (is_container_v<T>) {
+                return false;
+            } else if constexpr (to_tuple_works_v<T>) {
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return is_flat_fields<T, Fields>(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return true; // Written raw by the non-reflectable fallback
+            }
+        }
+
+        // Walk the reflected leaves and check each sits where the field-by-field encoder would put
+        // it. Catches members() lists that reorder, skip or alias fields, and packed structs.
+        template <typename T> bool flat_layout_matches(T &value, datapod::u8 const *base, datapod::usize &offset) {
+            if constexpr (std::is_array_v<T>) {
+                auto ok = flat_layout_matches(value[0], base, offset);
+                offset += (std::extent_v<T> - 1U) * sizeof(value[0]);
+                return ok;
+            } else if constexpr (flat_array<T>::value) {
+                auto ok = flat_layout_matches(value[0], base, offset);
+                offset += (flat_array<T>::extent - 1U) * sizeof(value[0]);
+                return ok;
+            } else if constexpr (std::is_class_v<T> && to_tuple_works_v<T>) {
+                auto ok = true;
+                for_each_field(value, [&](auto &field) { ok = flat_layout_matches(field, base, offset) && ok; });
+                return ok;
+            } else {
+                offset = (offset + alignof(T) - 1U) / alignof(T) * alignof(T);
+                auto const ok = reinterpret_cast<datapod::u8 const *>(&value) == base + offset;
+                offset += sizeof(T);
+                return ok;
+            }
+        }
+
+        template <typename T> bool has_flat_layout(T &value) {
+            datapod::usize offset = 0U;
+            return flat_layout_matches(value, reinterpret_cast<datapod::u8 const *>(&value), offset) &&
+                   offset == sizeof(T);
+        }
+    } // namespace detail
+
+    template <typename T> inline constexpr bool is_flat_v = detail::is_flat<decay_t<T>>();
+
+    namespace detail {
+        // Any leaf that Mode::COMPACT re-encodes as a varint
+        template <typename T> constexpr bool has_varint_leaf() noexcept {
+            if constexpr (std::is_scalar_v<T>) {
+                return is_varint<T>();
+            } else if constexpr (std::is_array_v<T>) {
+                return has_varint_leaf<std::remove_cv_t<std::remove_extent_t<T>>>();
+            } else if constexpr (flat_array<T>::value) {
+                return has_varint_leaf<typename flat_array<T>::element_type>();
+            } else if constexpr (std::is_class_v<T> && to_tuple_works_v<T>) {
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return []<datapod::usize... Is>(std::index_sequence<Is...>) {
+                    return (has_varint_leaf<std::remove_cvref_t<std::tuple_element_t<Is, Fields>>>() || ...);
+                }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return false;
+            }
+        }
+
+        template <Mode M, typename T> constexpr bool is_bulk_copyable() noexcept {
+            if constexpr (endian_conversion_necessary<M>() || !is_flat_v<T>) {
+                return false;
+            } else {
+                return is_mode_disabled(M, Mode::COMPACT) || !has_varint_leaf<decay_t<T>>();
+            }
+        }
+    } // namespace detail
+
+    // Flat elements can be block-copied when the mode needs no byte swapping
+    // (and, under Mode::COMPACT, holds no integers to re-encode)
+    template <Mode M, typename T> inline constexpr bool is_bulk_copyable_v = detail::is_bulk_copyable<M, T>();
+
+    template <Mode M, typename Ctx, typename T> void serialize_span(Ctx &ctx, T *data, datapod::usize n);
+
     // Serialize aggregate types (structs) using reflection
     template <Mode M, typename Ctx, typename T>
     std::enable_if_t<std::is_class_v<T> && !std::is_scalar_v<T> && !is_container_v<T>> //
@@ -134,9 +311,7 @@ namespace datapod {
         serialize<M>(ctx, const_cast<datapod::usize &>(sz));
 
         // Write elements
-        for (auto &elem : value) {
-            serialize<M>(ctx, elem);
-        }
+        serialize_span<M>(ctx, value.data(), sz);
     }
 
     // Serialize Optional
@@ -159,15 +334,25 @@ namespace datapod {
 
     // Serialize Array (fixed-size array)
     template <Mode M, typename Ctx, typename T, datapod::usize N> void serialize(Ctx &ctx, Array<T, N> &value) {
-        for (auto &elem : value) {
-            serialize<M>(ctx, elem);
-        }
+        serialize_span<M>(ctx, value.data(), N);
     }
 
     // Serialize C-style arrays (T[N])
     template <Mode M, typename Ctx, typename T, datapod::usize N> void serialize(Ctx &ctx, T (&value)[N]) {
-        for (datapod::usize i = 0; i < N; ++i) {
-            serialize<M>(ctx, value[i]);
+        serialize_span<M>(ctx, &value[0], N);
+    }
+
+    // Serialize a contiguous run of elements
+    // Flat elements go out as one aligned write, byte-identical to the per-element loop
+    template <Mode M, typename Ctx, typename T> void serialize_span(Ctx &ctx, T *data, datapod::usize n) {
+        if constexpr (is_bulk_copyable_v<M, T>) {
+            if (n != 0U && detail::has_flat_layout(data[0])) {
+                ctx.write(data, n * sizeof(T), alignof(T));
+                return;
+            }
+        }
+        for (datapod::usize i = 0; i < n; ++i) {
+            serialize<M>(ctx, data[i]);
         }
     }
 
@@ -210,27 +395,21 @@ namespace datapod {
     template <Mode M, typename Ctx, typename T, datapod::usize N>
     void serialize(Ctx &ctx, mat::Vector<T, N, true> &value) {
         // Fixed size, just write all elements
-        for (datapod::usize i = 0; i < N; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), N);
     }
 
     // Serialize stack-allocated mat::Vector
     template <Mode M, typename Ctx, typename T, datapod::usize N>
     void serialize(Ctx &ctx, mat::Vector<T, N, false> &value) {
         // Fixed size, just write all elements
-        for (datapod::usize i = 0; i < N; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), N);
     }
 
     // Serialize heap-allocated mat::Matrix
     template <Mode M, typename Ctx, typename T, datapod::usize R, datapod::usize C>
     void serialize(Ctx &ctx, mat::Matrix<T, R, C, true> &value) {
         // Fixed size, just write all elements (column-major order)
-        for (datapod::usize i = 0; i < R * C; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), R * C);
     }
 
     // Serialize heap-allocated mat::HeapTensor
@@ -238,9 +417,7 @@ namespace datapod {
     void serialize(Ctx &ctx, mat::HeapTensor<T, Dims...> &value) {
         // Fixed size, just write all elements
         constexpr datapod::usize total = (Dims * ...);
-        for (datapod::usize i = 0; i < total; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), total);
     }
 
     // =============================================================================
@@ -255,9 +432,7 @@ namespace datapod {
         serialize<M>(ctx, sz);
 
         // Write elements
-        for (datapod::usize i = 0; i < sz; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), sz);
     }
 
     // Serialize mat::Matrix<T, Dynamic, Dynamic>
@@ -271,10 +446,7 @@ namespace datapod {
         serialize<M>(ctx, cols);
 
         // Write elements (column-major order)
-        datapod::usize total = rows * cols;
-        for (datapod::usize i = 0; i < total; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), rows * cols);
     }
 
     // Serialize mat::DynamicTensor (fully runtime-ranked)
@@ -291,10 +463,7 @@ namespace datapod {
         }
 
         // Write elements (column-major order)
-        datapod::usize total = value.size();
-        for (datapod::usize i = 0; i < total; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), value.size());
     }
 
     // Serialize mat::Tensor<T, Dims...> where any Dim is Dynamic (partially dynamic tensor)
@@ -313,25 +482,44 @@ namespace datapod {
         }
 
         // Write elements (column-major order)
-        datapod::usize total = value.size();
-        for (datapod::usize i = 0; i < total; ++i) {
-            serialize<M>(ctx, value[i]);
-        }
+        serialize_span<M>(ctx, value.data(), value.size());
     }
 
     // =============================================================================
     // Main serialize entry point
     // =============================================================================
 
-    template <Mode M = Mode::NONE, typename T> ByteBuf serialize(T &el) {
-        auto b = Buf{};
-        auto ctx = SerializationContext<Buf<ByteBuf>, M>{b};
+    // Exact number of bytes serialize<M>(el) produces, headers and alignment padding included
+    // Runs the regular encoder against a SizeCounter, so it follows the same reflection walk
+    template <Mode M = Mode::NONE, typename T> datapod::usize serialized_size_of(T const &el) {
+        auto counter = SizeCounter{};
+        auto ctx = SerializationContext<SizeCounter, M>{counter};
+
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            ctx.write(nullptr, sizeof(hash_t), alignof(hash_t));
+        }
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            ctx.write(nullptr, sizeof(hash_t), alignof(hash_t));
+        }
+
+        serialize<M>(ctx, const_cast<T &>(el));
+        return counter.size();
+    }
+
+    // Write el, headers included, to any serialization target (Buf, Buf<Mmap>, FdBuf, ...)
+    template <Mode M = Mode::NONE, typename Target, typename T> void serialize_to(Target &target, T &el) {
+        auto ctx = SerializationContext<Target, M>{target};
 
         // Write integrity checksum placeholder if requested
         offset_t integrity_offset = 0;
         if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
             hash_t placeholder = 0;
             integrity_offset = ctx.write(&placeholder, sizeof(hash_t), alignof(hash_t));
+
+            // Streaming targets hash bytes as they leave, so they need to know where to start
+            if constexpr (requires { target.template begin_checksum<M>(integrity_offset); }) {
+                target.template begin_checksum<M>(integrity_offset + static_cast<offset_t>(sizeof(hash_t)));
+            }
         }
 
         // Write version hash if requested
@@ -345,12 +533,17 @@ namespace datapod {
         // Calculate and write integrity checksum
         if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
             auto const checksum_start = integrity_offset + static_cast<offset_t>(sizeof(hash_t));
-            auto const csum = b.checksum(checksum_start);
+            auto const csum = target.template checksum<M>(checksum_start);
             auto const csum_converted = convert_endian<M>(csum);
             ctx.write(static_cast<datapod::usize>(integrity_offset), csum_converted);
         }
+    }
 
-        return std::move(b.buf_);
+    template <Mode M = Mode::NONE, typename T> ByteBuf serialize(T &el) {
+        auto b = Buf{};
+        b.allocate(serialized_size_of<M>(el));
+        serialize_to<M>(b, el);
+        return b.release();
     }
 
     // =============================================================================
@@ -366,13 +559,30 @@ namespace datapod {
         // Read raw data
         void read(void *dest, datapod::usize num_bytes) {
             verify(pos_ + num_bytes <= size_, "deserialization: out of bounds read");
+            if (hashing_ && num_bytes > INTEGRITY_STEP_BYTES) {
+                // Hash large reads step by step right after copying them
+                hash_pending(0U);
+                auto *out = static_cast<datapod::u8 *>(dest);
+                for (datapod::usize done = 0U; done != num_bytes;) {
+                    auto const step = std::min(INTEGRITY_STEP_BYTES, num_bytes - done);
+                    std::memcpy(out + done, data_ + pos_ + done, step);
+                    hasher_.update(data_ + pos_ + done, step);
+                    done += step;
+                }
+                pos_ += num_bytes;
+                hashed_ = pos_;
+                return;
+            }
             std::memcpy(dest, data_ + pos_, num_bytes);
             pos_ += num_bytes;
+            if (hashing_) {
+                hash_pending(INTEGRITY_STEP_BYTES);
+            }
         }
 
-        // Skip alignment padding
+        // Skip alignment padding (Mode::COMPACT has none)
         void align(datapod::usize alignment) {
-            if (alignment > 1) {
+            if (alignment > 1 && is_mode_disabled(M, Mode::COMPACT)) {
                 auto const remainder = pos_ % alignment;
                 if (remainder != 0) {
                     pos_ += alignment - remainder;
@@ -380,21 +590,158 @@ namespace datapod {
             }
         }
 
+        // Decode a varint in place; the bytes are hashed along with the next read or checksum()
+        datapod::u64 read_varint() {
+            datapod::u64 v = 0U;
+            auto const n = pos_ < size_ ? varint_decode(data_ + pos_, data_ + size_, v) : 0U;
+            verify(n != 0U, "deserialization: malformed varint");
+            pos_ += n;
+            return v;
+        }
+
+        // Bytes left after the read position
+        datapod::usize remaining() const noexcept { return pos_ < size_ ? size_ - pos_ : 0U; }
+
+        // Hash every byte from the read position on as it is consumed
+        void begin_checksum() noexcept {
+            hashing_ = true;
+            hashed_ = pos_;
+            hasher_ = IntegrityHasher::for_mode<M>();
+        }
+
+        // Hash since begin_checksum(), through the end of the input
+        hash_t checksum() noexcept {
+            if (size_ > hashed_) {
+                hasher_.update(data_ + hashed_, size_ - hashed_);
+                hashed_ = size_;
+            }
+            return hasher_.digest();
+        }
+
         datapod::u8 const *data_;
         datapod::usize size_;
         datapod::usize pos_;
+
+      private:
+        void hash_pending(datapod::usize const min_bytes) noexcept {
+            auto const end = std::min(pos_, size_);
+            if (end > hashed_ && end - hashed_ >= min_bytes) {
+                hasher_.update(data_ + hashed_, end - hashed_);
+                hashed_ = end;
+            }
+        }
+
+        IntegrityHasher hasher_{};
+        bool hashing_{false};
+        datapod::usize hashed_{0U};
     };
 
     // =============================================================================
     // Deserialize Implementation
     // =============================================================================
 
+    template <Mode M, typename Ctx, typename T> void deserialize_span(Ctx &ctx, T *data, datapod::usize n);
+
+    namespace detail {
+        template <typename T> struct length_prefixed : std::false_type {};
+        template <> struct length_prefixed<String> : std::true_type {};
+        template <> struct length_prefixed<Cstring> : std::true_type {};
+        template <typename T> struct length_prefixed<Vector<T>> : std::true_type {};
+
+        // Read a varint through any context, one byte at a time unless it decodes in place
+        template <typename Ctx> datapod::u64 read_varint(Ctx &ctx) {
+            if constexpr (requires { ctx.read_varint(); }) {
+                return ctx.read_varint();
+            } else {
+                datapod::u8 bytes[VARINT_MAX_BYTES];
+                datapod::usize n = 0U;
+                do {
+                    verify(n != VARINT_MAX_BYTES, "deserialization: malformed varint");
+                    ctx.read(&bytes[n], 1U);
+                } while ((bytes[n++] & 0x80U) != 0U);
+
+                datapod::u64 v = 0U;
+                verify(varint_decode(bytes, bytes + n, v) == n, "deserialization: malformed varint");
+                return v;
+            }
+        }
+
+        template <typename T> struct is_pair : std::false_type {};
+        template <typename A, typename B> struct is_pair<Pair<A, B>> : std::true_type {};
+
+        // Fixed-size mat containers: element type and element count
+        template <typename T> struct fixed_mat : std::false_type {};
+        template <typename T, datapod::usize N, bool H>
+        requires(N != mat::Dynamic)
+        struct fixed_mat<mat::Vector<T, N, H>> : std::true_type {
+            using element_type = T;
+            static constexpr datapod::usize extent = N;
+        };
+        template <typename T, datapod::usize R, datapod::usize C>
+        struct fixed_mat<mat::Matrix<T, R, C, true>> : std::true_type {
+            using element_type = T;
+            static constexpr datapod::usize extent = R * C;
+        };
+        template <typename T, datapod::usize... Dims>
+        struct fixed_mat<mat::HeapTensor<T, Dims...>> : std::true_type {
+            using element_type = T;
+            static constexpr datapod::usize extent = (Dims * ...);
+        };
+
+        // Whether a T can encode to zero bytes: only structs, arrays and tuples with nothing in them
+        // (or made only of such members). Everything else takes at least one byte per element.
+        template <typename T> constexpr bool may_encode_empty() noexcept {
+            if constexpr (std::is_scalar_v<T>) {
+                return false;
+            } else if constexpr (std::is_array_v<T>) {
+                return may_encode_empty<std::remove_cv_t<std::remove_extent_t<T>>>();
+            } else if constexpr (flat_array<T>::value) {
+                return flat_array<T>::extent == 0U || may_encode_empty<typename flat_array<T>::element_type>();
+            } else if constexpr (fixed_mat<T>::value) {
+                return fixed_mat<T>::extent == 0U || may_encode_empty<typename fixed_mat<T>::element_type>();
+            } else if constexpr (is_pair<T>::value) {
+                return may_encode_empty<typename T::first_type>() && may_encode_empty<typename T::second_type>();
+            } else if constexpr (is_tuple_v<T>) {
+                return []<typename... Ts>(Tuple<Ts...> const *) {
+                    return (may_encode_empty<Ts>() && ...);
+                }(static_cast<T const *>(nullptr));
+            } else if constexpr (is_container_v<T>) {
+                return false; // Length prefix, flag or variant index
+            } else if constexpr (std::is_class_v<T> && to_tuple_works_v<T>) {
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return []<datapod::usize... Is>(std::index_sequence<Is...>) {
+                    return (may_encode_empty<std::remove_cvref_t<std::tuple_element_t<Is, Fields>>>() && ...);
+                }(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return false; // Written raw, sizeof(T) >= 1
+            }
+        }
+
+        // Reject a length prefix that cannot fit in the remaining input before allocating for it
+        // Every element that cannot encode to zero bytes takes at least one, so n elements need n bytes.
+        template <typename T, typename Ctx> void check_length(Ctx const &ctx, datapod::usize const n) {
+            if constexpr (requires { ctx.remaining(); } && !may_encode_empty<T>()) {
+                verify(n <= ctx.remaining(), "deserialization: length exceeds input");
+            }
+        }
+
+        // a * b element count, rejecting products that overflow
+        inline datapod::usize checked_count(datapod::usize const a, datapod::usize const b) {
+            verify(b == 0U || a <= std::numeric_limits<datapod::usize>::max() / b, "deserialization: length overflow");
+            return a * b;
+        }
+    } // namespace detail
+
     // Deserialize scalar types
     template <Mode M, typename Ctx, typename T> std::enable_if_t<std::is_scalar_v<T>> deserialize(Ctx &ctx, T &value) {
-        ctx.align(alignof(T));
-        T temp;
-        ctx.read(&temp, sizeof(T));
-        value = convert_endian<M>(temp);
+        if constexpr (is_varint_encoded_v<M, T>) {
+            value = detail::from_varint<T>(detail::read_varint(ctx));
+        } else {
+            ctx.align(alignof(T));
+            T temp;
+            ctx.read(&temp, sizeof(T));
+            value = convert_endian<M>(temp);
+        }
     }
 
     // Deserialize aggregate types using reflection
@@ -415,6 +762,7 @@ namespace datapod {
         // Read length
         datapod::usize len = 0;
         deserialize<M>(ctx, len);
+        detail::check_length<char>(ctx, len);
 
         // Read string data
         if (len > 0) {
@@ -431,6 +779,7 @@ namespace datapod {
         // Read length as u32 (Cstring uses u32 for size)
         datapod::u32 len = 0;
         deserialize<M>(ctx, len);
+        detail::check_length<char>(ctx, len);
 
         // Read string data
         if (len > 0) {
@@ -448,12 +797,11 @@ namespace datapod {
         // Read size
         datapod::usize sz = 0;
         deserialize<M>(ctx, sz);
+        detail::check_length<T>(ctx, sz);
 
         // Read elements
         value.resize(sz);
-        for (auto &elem : value) {
-            deserialize<M>(ctx, elem);
-        }
+        deserialize_span<M>(ctx, value.data(), sz);
     }
 
     // Deserialize Optional
@@ -480,15 +828,26 @@ namespace datapod {
 
     // Deserialize Array (fixed-size array)
     template <Mode M, typename Ctx, typename T, datapod::usize N> void deserialize(Ctx &ctx, Array<T, N> &value) {
-        for (auto &elem : value) {
-            deserialize<M>(ctx, elem);
-        }
+        deserialize_span<M>(ctx, value.data(), N);
     }
 
     // Deserialize C-style arrays (T[N])
     template <Mode M, typename Ctx, typename T, datapod::usize N> void deserialize(Ctx &ctx, T (&value)[N]) {
-        for (datapod::usize i = 0; i < N; ++i) {
-            deserialize<M>(ctx, value[i]);
+        deserialize_span<M>(ctx, &value[0], N);
+    }
+
+    // Deserialize a contiguous run of elements
+    // Flat elements are read back with one memcpy
+    template <Mode M, typename Ctx, typename T> void deserialize_span(Ctx &ctx, T *data, datapod::usize n) {
+        if constexpr (is_bulk_copyable_v<M, T>) {
+            if (n != 0U && detail::has_flat_layout(data[0])) {
+                ctx.align(alignof(T));
+                ctx.read(data, n * sizeof(T));
+                return;
+            }
+        }
+        for (datapod::usize i = 0; i < n; ++i) {
+            deserialize<M>(ctx, data[i]);
         }
     }
 
@@ -532,6 +891,7 @@ namespace datapod {
         // Read size
         datapod::usize sz = 0;
         deserialize<M>(ctx, sz);
+        detail::check_length<T>(ctx, sz);
 
         // Clear existing entries
         value.clear();
@@ -552,27 +912,21 @@ namespace datapod {
     template <Mode M, typename Ctx, typename T, datapod::usize N>
     void deserialize(Ctx &ctx, mat::Vector<T, N, true> &value) {
         // Fixed size, read all elements
-        for (datapod::usize i = 0; i < N; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), N);
     }
 
     // Deserialize stack-allocated mat::Vector
     template <Mode M, typename Ctx, typename T, datapod::usize N>
     void deserialize(Ctx &ctx, mat::Vector<T, N, false> &value) {
         // Fixed size, read all elements
-        for (datapod::usize i = 0; i < N; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), N);
     }
 
     // Deserialize heap-allocated mat::Matrix
     template <Mode M, typename Ctx, typename T, datapod::usize R, datapod::usize C>
     void deserialize(Ctx &ctx, mat::Matrix<T, R, C, true> &value) {
         // Fixed size, read all elements (column-major order)
-        for (datapod::usize i = 0; i < R * C; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), R * C);
     }
 
     // Deserialize heap-allocated mat::HeapTensor
@@ -580,9 +934,7 @@ namespace datapod {
     void deserialize(Ctx &ctx, mat::HeapTensor<T, Dims...> &value) {
         // Fixed size, read all elements
         constexpr datapod::usize total = (Dims * ...);
-        for (datapod::usize i = 0; i < total; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), total);
     }
 
     // =============================================================================
@@ -594,12 +946,11 @@ namespace datapod {
         // Read size
         datapod::usize sz = 0;
         deserialize<M>(ctx, sz);
+        detail::check_length<T>(ctx, sz);
 
         // Resize and read elements
         value.resize(sz);
-        for (datapod::usize i = 0; i < sz; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), sz);
     }
 
     // Deserialize mat::Matrix<T, Dynamic, Dynamic>
@@ -609,13 +960,11 @@ namespace datapod {
         datapod::usize rows = 0, cols = 0;
         deserialize<M>(ctx, rows);
         deserialize<M>(ctx, cols);
+        detail::check_length<T>(ctx, detail::checked_count(rows, cols));
 
         // Resize and read elements
         value.resize(rows, cols);
-        datapod::usize total = rows * cols;
-        for (datapod::usize i = 0; i < total; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), rows * cols);
     }
 
     // Deserialize mat::DynamicTensor (fully runtime-ranked)
@@ -623,20 +972,21 @@ namespace datapod {
         // Read rank
         datapod::usize r = 0;
         deserialize<M>(ctx, r);
+        detail::check_length<datapod::usize>(ctx, r);
 
         // Read dimensions
         Vector<datapod::usize> dims;
         dims.resize(r);
+        datapod::usize total = r == 0U ? 0U : 1U;
         for (datapod::usize i = 0; i < r; ++i) {
             deserialize<M>(ctx, dims[i]);
+            total = detail::checked_count(total, dims[i]);
         }
+        detail::check_length<T>(ctx, total);
 
         // Resize and read elements
         value.resize(dims);
-        datapod::usize total = value.size();
-        for (datapod::usize i = 0; i < total; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), value.size());
     }
 
     // Deserialize mat::Tensor<T, Dims...> where any Dim is Dynamic (partially dynamic tensor)
@@ -651,11 +1001,16 @@ namespace datapod {
         // Read dynamic dimensions
         std::array<datapod::usize, num_dynamic> dyn_dims{};
         datapod::usize dyn_idx = 0;
+        datapod::usize total = 1U;
         for (datapod::usize i = 0; i < rank; ++i) {
             if (template_dims[i] == mat::Dynamic) {
-                deserialize<M>(ctx, dyn_dims[dyn_idx++]);
+                deserialize<M>(ctx, dyn_dims[dyn_idx]);
+                total = detail::checked_count(total, dyn_dims[dyn_idx++]);
+            } else {
+                total = detail::checked_count(total, template_dims[i]);
             }
         }
+        detail::check_length<T>(ctx, total);
 
         // Resize using the dynamic dimensions
         // We need to unpack dyn_dims into the resize call
@@ -664,75 +1019,61 @@ namespace datapod {
         }(std::make_index_sequence<num_dynamic>{});
 
         // Read elements
-        datapod::usize total = value.size();
-        for (datapod::usize i = 0; i < total; ++i) {
-            deserialize<M>(ctx, value[i]);
-        }
+        deserialize_span<M>(ctx, value.data(), value.size());
     }
 
     // =============================================================================
     // Main deserialize entry point
     // =============================================================================
 
-    template <Mode M = Mode::NONE, typename T> T deserialize(ByteBuf const &buf) {
-        T result{};
-        auto ctx = DeserializationContext<M>{buf.data(), buf.size()};
-
-        // Verify integrity checksum if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
-            hash_t stored_checksum;
-            ctx.align(alignof(hash_t));
-            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
-            ctx.read(&stored_checksum, sizeof(hash_t));
-
-            // Calculate checksum of data after the stored checksum
-            auto const calculated_checksum = hash(std::string_view{
-                reinterpret_cast<char const *>(buf.data() + checksum_start), buf.size() - checksum_start});
-
-            verify(convert_endian<M>(stored_checksum) == calculated_checksum, "integrity check failed: data corrupted");
-        }
+    namespace detail {
+        // Headers and body in a single pass: the integrity hash runs inside ctx.read() and is
+        // compared once decoding is done. Anything that fails while decoding corrupted input is
+        // reported as an integrity failure.
+        template <Mode M, typename T> void deserialize_checked(DeserializationContext<M> &ctx, T &result) {
+            hash_t stored_checksum = 0;
+            if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+                ctx.align(alignof(hash_t));
+                ctx.read(&stored_checksum, sizeof(hash_t));
+                ctx.begin_checksum();
+            }
+            auto const verify_integrity = [&] {
+                if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+                    verify(convert_endian<M>(stored_checksum) == ctx.checksum(),
+                           "integrity check failed: data corrupted");
+                }
+            };
+
+            try {
+                // Verify version hash if present
+                if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+                    hash_t stored_hash;
+                    ctx.align(alignof(hash_t));
+                    ctx.read(&stored_hash, sizeof(hash_t));
+                    auto const expected_hash = type_hash<decay_t<T>>();
+                    verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
+                }
 
-        // Verify version hash if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
-            hash_t stored_hash;
-            ctx.align(alignof(hash_t));
-            ctx.read(&stored_hash, sizeof(hash_t));
-            auto const expected_hash = type_hash<decay_t<T>>();
-            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
+                deserialize<M>(ctx, result);
+            } catch (...) {
+                verify_integrity();
+                throw;
+            }
+            verify_integrity();
         }
+    } // namespace detail
 
-        deserialize<M>(ctx, result);
+    template <Mode M = Mode::NONE, typename T> T deserialize(ByteBuf const &buf) {
+        T result{};
+        auto ctx = DeserializationContext<M>{buf.data(), buf.size()};
+        detail::deserialize_checked<M>(ctx, result);
         return result;
     }
 
     template <Mode M = Mode::NONE, typename T> T deserialize(datapod::u8 const *data, datapod::usize size) {
         T result{};
         auto ctx = DeserializationContext<M>{data, size};
-
-        // Verify integrity checksum if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
-            hash_t stored_checksum;
-            ctx.align(alignof(hash_t));
-            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
-            ctx.read(&stored_checksum, sizeof(hash_t));
-
-            // Calculate checksum of data after the stored checksum
-            auto const calculated_checksum =
-                hash(std::string_view{reinterpret_cast<char const *>(data + checksum_start), size - checksum_start});
-
-            verify(convert_endian<M>(stored_checksum) == calculated_checksum, "integrity check failed: data corrupted");
-        }
-
-        // Verify version hash if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
-            hash_t stored_hash;
-            ctx.align(alignof(hash_t));
-            ctx.read(&stored_hash, sizeof(hash_t));
-            auto const expected_hash = type_hash<decay_t<T>>();
-            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
-        }
-
-        deserialize<M>(ctx, result);
+        detail::deserialize_checked<M>(ctx, result);
         return result;
     }
 
@@ -747,31 +1088,7 @@ namespace datapod {
     // Overload for deserialize with explicit type parameter (alternative syntax)
     template <Mode M = Mode::NONE, typename T> void deserialize(ByteBuf const &buf, T &result) {
         auto ctx = DeserializationContext<M>{buf.data(), buf.size()};
-
-        // Verify integrity checksum if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
-            hash_t stored_checksum;
-            ctx.align(alignof(hash_t));
-            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
-            ctx.read(&stored_checksum, sizeof(hash_t));
-
-            // Calculate checksum of data after the stored checksum
-            auto const calculated_checksum = hash(std::string_view{
-                reinterpret_cast<char const *>(buf.data() + checksum_start), buf.size() - checksum_start});
-
-            verify(convert_endian<M>(stored_checksum) == calculated_checksum, "integrity check failed: data corrupted");
-        }
-
-        // Verify version hash if present
-        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
-            hash_t stored_hash;
-            ctx.align(alignof(hash_t));
-            ctx.read(&stored_hash, sizeof(hash_t));
-            auto const expected_hash = type_hash<decay_t<T>>();
-            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
-        }
-
-        deserialize<M>(ctx, result);
+        detail::deserialize_checked<M>(ctx, result);
     }
 
     // =============================================================================
@@ -0,0 +1,372 @@
+#pragma once
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "datapod/core/hash.hpp"
+#include "datapod/core/mmap.hpp"
+#include "datapod/core/mode.hpp"
+#include "datapod/core/offset_t.hpp"
+#include "datapod/core/verify.hpp"
+#include "datapod/serialization/buf.hpp"
+#include "datapod/serialization/serialize.hpp"
+#include "datapod/serialization/serialized_size.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Streaming targets
+    // =============================================================================
+    //
+    // serialize() builds the whole encoding in a ByteBuf before it can be written out. The
+    // targets below keep peak memory bounded instead:
+    //   - Buf<Mmap>: grows a memory-mapped file in place (serialize_to_file)
+    //   - FdBuf: stages into a fixed-size buffer and hands it to writev() (serialize_to_fd)
+    //   - FdDeserializationContext: reads an fd through a fixed-size buffer (deserialize_from_fd)
+
+    // Write el to a file through a growing Mmap, sized once up front
+    template <Mode M = Mode::NONE, typename T> void serialize_to_file(char const *path, T &el) {
+        auto b = Buf{Mmap{path, Mmap::Protection::WRITE}};
+        b.allocate(serialized_size_of<M>(el));
+        serialize_to<M>(b, el);
+        b.release(); // Trims the file to the written size when the Mmap closes
+    }
+
+#ifndef _WIN32
+
+    // Serialization target streaming to a file descriptor through a bounded staging buffer
+    // Writes at least as large as the buffer bypass it and go out together with the staged bytes
+    // in one writev(). Back-patches into bytes already written (integrity checksum) use pwrite(),
+    // so they need a seekable fd.
+    struct FdBuf {
+        static constexpr datapod::usize DEFAULT_CAPACITY = 64U * 1024U;
+
+        explicit FdBuf(int const fd, datapod::usize const capacity = DEFAULT_CAPACITY)
+            : fd_{fd}, file_start_{::lseek(fd, 0, SEEK_CUR)}, capacity_{capacity} {
+            verify(capacity_ != 0U, "FdBuf: capacity must be non-zero");
+            staging_.reserve(capacity_);
+        }
+
+        FdBuf(FdBuf const &) = delete;
+        FdBuf &operator=(FdBuf const &) = delete;
+
+        // Write raw data with optional alignment (relative to the stream start)
+        offset_t write(void const *ptr, datapod::usize const num_bytes, datapod::usize alignment = 0U) {
+            auto start = size_;
+            if (alignment > 1U) {
+                start = (start + alignment - 1U) / alignment * alignment;
+            }
+            staging_.resize(staging_.size() + (start - size_), 0U);
+
+            if (num_bytes >= capacity_) {
+                flush(ptr, num_bytes);
+            } else if (num_bytes != 0U) {
+                if (staging_.size() + num_bytes > capacity_) {
+                    flush();
+                }
+                auto const *p = static_cast<datapod::u8 const *>(ptr);
+                staging_.insert(staging_.end(), p, p + num_bytes);
+            }
+            size_ = start + num_bytes;
+
+            return static_cast<offset_t>(start);
+        }
+
+        // Write a value at a specific position
+        template <typename T> void write(datapod::usize const pos, T const &val) {
+            auto const n = serialized_size<T>();
+            verify(size_ >= pos + n, "out of bounds write");
+            if (pos >= flushed_) {
+                std::memcpy(staging_.data() + (pos - flushed_), &val, n);
+                return;
+            }
+            verify(pos + n <= flushed_, "FdBuf: write straddles flushed data");
+            verify(file_start_ != -1, "FdBuf: fd is not seekable");
+            verify(::pwrite(fd_, &val, n, file_start_ + static_cast<off_t>(pos)) == static_cast<ssize_t>(n),
+                   "FdBuf: pwrite error");
+            hash_dirty_ = hash_dirty_ || (hashing_ && pos + n > hash_start_);
+        }
+
+        // Start hashing bytes at the given offset as they are flushed
+        template <Mode M = Mode::NONE> void begin_checksum(offset_t const start) noexcept {
+            hashing_ = true;
+            hash_start_ = static_cast<datapod::usize>(start);
+            hasher_ = IntegrityHasher::for_mode<M>();
+        }
+
+        // Checksum of everything written from the begin_checksum() offset on
+        template <Mode M = Mode::NONE> datapod::u64 checksum(offset_t const start = 0U) {
+            verify(hashing_ && hash_start_ == static_cast<datapod::usize>(start),
+                   "FdBuf: checksum start must be announced with begin_checksum()");
+            flush();
+            verify(!hash_dirty_, "FdBuf: checksummed data was patched after it was written");
+            return hasher_.digest();
+        }
+
+        // Push all staged bytes to the fd
+        void flush() { flush(nullptr, 0U); }
+
+        datapod::usize size() const noexcept { return size_; }
+
+      private:
+        void hash_range(datapod::u8 const *p, datapod::usize n, datapod::usize pos) noexcept {
+            if (!hashing_ || pos + n <= hash_start_) {
+                return;
+            }
+            auto const skip = pos < hash_start_ ? hash_start_ - pos : 0U;
+            hasher_.update(p + skip, n - skip);
+        }
+
+        // Flush the staging buffer followed by an optional payload with a single writev()
+        void flush(void const *payload, datapod::usize const payload_size) {
+            hash_range(staging_.data(), staging_.size(), flushed_);
+            hash_range(static_cast<datapod::u8 const *>(payload), payload_size, flushed_ + staging_.size());
+
+            iovec iov[2] = {{staging_.data(), staging_.size()}, {const_cast<void *>(payload), payload_size}};
+            auto *first = iov;
+            auto count = 2;
+            while (count != 0 && first->iov_len == 0U) {
+                ++first;
+                --count;
+            }
+            while (count != 0) {
+                auto const written = ::writev(fd_, first, count);
+                if (written == -1 && errno == EINTR) {
+                    continue;
+                }
+                verify(written != -1, "FdBuf: writev error");
+
+                // Advance past partially written vectors
+                auto remaining = static_cast<datapod::usize>(written);
+                while (count != 0 && remaining >= first->iov_len) {
+                    remaining -= first->iov_len;
+                    ++first;
+                    --count;
+                }
+                if (count != 0) {
+                    first->iov_base = static_cast<datapod::u8 *>(first->iov_base) + remaining;
+                    first->iov_len -= remaining;
+                }
+            }
+
+            flushed_ += staging_.size() + payload_size;
+            staging_.clear();
+        }
+
+        int fd_;
+        off_t file_start_;
+        datapod::usize capacity_;
+        std::vector<datapod::u8> staging_;
+        datapod::usize size_{0U};
+        datapod::usize flushed_{0U};
+        bool hashing_{false};
+        bool hash_dirty_{false};
+        datapod::usize hash_start_{0U};
+        IntegrityHasher hasher_{};
+    };
+
+    // Stream el to a file descriptor with O(capacity) extra memory
+    template <Mode M = Mode::NONE, typename T>
+    void serialize_to_fd(int const fd, T &el, datapod::usize const capacity = FdBuf::DEFAULT_CAPACITY) {
+        auto b = FdBuf{fd, capacity};
+        serialize_to<M>(b, el);
+        b.flush();
+    }
+
+    // Deserialization context reading from a file descriptor in chunks
+    // Same read()/align()/pos_ interface as DeserializationContext, so every deserialize()
+    // overload works unchanged; reads at least as large as the buffer go straight to the
+    // destination. finish() seeks a seekable fd back to the end of the message; a pipe or socket
+    // is left read ahead by up to one buffer.
+    template <Mode M> struct FdDeserializationContext {
+        static constexpr Mode MODE = M;
+        static constexpr datapod::usize DEFAULT_CAPACITY = 64U * 1024U;
+
+        explicit FdDeserializationContext(int const fd, datapod::usize const capacity = DEFAULT_CAPACITY)
+            : fd_{fd}, buf_(capacity), pos_{0}, limit_{input_size(fd)} {
+            verify(capacity != 0U, "FdDeserializationContext: capacity must be non-zero");
+        }
+
+        // Bytes left between the read position and the end of a regular file
+        // Pipes and sockets have no known end and report no bound.
+        datapod::usize remaining() const noexcept { return pos_ < limit_ ? limit_ - pos_ : 0U; }
+
+        // Read raw data
+        void read(void *dest, datapod::usize num_bytes) {
+            verify(num_bytes <= remaining(), "deserialization: out of bounds read");
+            auto *out = static_cast<datapod::u8 *>(dest);
+            pos_ += num_bytes;
+            while (num_bytes != 0U) {
+                if (begin_ == end_) {
+                    if (num_bytes >= buf_.size()) {
+                        read_direct(out, num_bytes);
+                        return;
+                    }
+                    refill();
+                }
+                auto const n = std::min(num_bytes, end_ - begin_);
+                std::memcpy(out, buf_.data() + begin_, n);
+                begin_ += n;
+                out += n;
+                num_bytes -= n;
+            }
+        }
+
+        // Skip alignment padding (Mode::COMPACT has none)
+        void align(datapod::usize alignment) {
+            if (alignment > 1 && is_mode_disabled(M, Mode::COMPACT)) {
+                auto const remainder = pos_ % alignment;
+                if (remainder != 0) {
+                    skip(alignment - remainder);
+                }
+            }
+        }
+
+        // Hash every byte consumed from here on
+        void begin_checksum() noexcept {
+            hashing_ = true;
+            hasher_ = IntegrityHasher::for_mode<M>();
+            hashed_ = begin_;
+        }
+
+        // Hash of the bytes consumed since begin_checksum(): the range the writer hashed
+        hash_t checksum() {
+            hash_pending();
+            return hasher_.digest();
+        }
+
+        // Give back the bytes buffered past the message, so the fd sits right after it
+        // Non-seekable fds (pipes, sockets) cannot rewind and stay read ahead.
+        void finish() noexcept {
+            if (end_ > begin_ && ::lseek(fd_, -static_cast<off_t>(end_ - begin_), SEEK_CUR) != -1) {
+                end_ = begin_;
+            }
+        }
+
+        int fd_;
+        std::vector<datapod::u8> buf_;
+        datapod::usize begin_{0U};
+        datapod::usize end_{0U};
+        datapod::usize pos_;
+        datapod::usize limit_;
+
+      private:
+        // Size of a regular file past the current offset, the most any message read from it can span
+        static datapod::usize input_size(int const fd) noexcept {
+            struct stat st{};
+            auto const offset = ::lseek(fd, 0, SEEK_CUR);
+            if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || offset == -1) {
+                return std::numeric_limits<datapod::usize>::max();
+            }
+            return st.st_size > offset ? static_cast<datapod::usize>(st.st_size - offset) : 0U;
+        }
+
+        void skip(datapod::usize n) {
+            verify(n <= remaining(), "deserialization: out of bounds read");
+            pos_ += n;
+            while (n != 0U) {
+                if (begin_ == end_) {
+                    refill();
+                }
+                auto const step = std::min(n, end_ - begin_);
+                begin_ += step;
+                n -= step;
+            }
+        }
+
+        void hash_pending() noexcept {
+            if (hashing_ && begin_ > hashed_) {
+                hasher_.update(buf_.data() + hashed_, begin_ - hashed_);
+            }
+            hashed_ = begin_;
+        }
+
+        // Read up to one buffer's worth; false on end of stream
+        bool fill() {
+            begin_ = end_ = hashed_ = 0U;
+            while (true) {
+                auto const n = ::read(fd_, buf_.data(), buf_.size());
+                if (n == -1 && errno == EINTR) {
+                    continue;
+                }
+                verify(n != -1, "deserialization: read error");
+                end_ = static_cast<datapod::usize>(n);
+                return n != 0;
+            }
+        }
+
+        void refill() {
+            hash_pending();
+            verify(fill(), "deserialization: out of bounds read");
+        }
+
+        void read_direct(datapod::u8 *out, datapod::usize num_bytes) {
+            hash_pending();
+            auto *const start = out;
+            while (num_bytes != 0U) {
+                auto const n = ::read(fd_, out, num_bytes);
+                if (n == -1 && errno == EINTR) {
+                    continue;
+                }
+                verify(n > 0, "deserialization: out of bounds read");
+                out += n;
+                num_bytes -= static_cast<datapod::usize>(n);
+            }
+            if (hashing_) {
+                hasher_.update(start, static_cast<datapod::usize>(out - start));
+            }
+        }
+
+        bool hashing_{false};
+        datapod::usize hashed_{0U};
+        IntegrityHasher hasher_{};
+    };
+
+    // Read a T from a file descriptor with O(capacity) extra memory
+    // Reading starts at the fd's current offset and, on a seekable fd, ends right after the message,
+    // so messages written back to back by serialize_to_fd() can be read one after another.
+    // The integrity checksum covers the whole message, so it is verified after decoding.
+    template <Mode M = Mode::NONE, typename T>
+    T deserialize_from_fd(int const fd,
+                          datapod::usize const capacity = FdDeserializationContext<M>::DEFAULT_CAPACITY) {
+        T result{};
+        auto ctx = FdDeserializationContext<M>{fd, capacity};
+
+        hash_t stored_checksum = 0;
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            ctx.align(alignof(hash_t));
+            ctx.read(&stored_checksum, sizeof(hash_t));
+            ctx.begin_checksum();
+        }
+
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            hash_t stored_hash;
+            ctx.align(alignof(hash_t));
+            ctx.read(&stored_hash, sizeof(hash_t));
+            auto const expected_hash = type_hash<decay_t<T>>();
+            verify(convert_endian<M>(stored_hash) == expected_hash, "version mismatch: type schema changed");
+        }
+
+        deserialize<M>(ctx, result);
+        ctx.finish();
+
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            verify(convert_endian<M>(stored_checksum) == ctx.checksum(), "integrity check failed: data corrupted");
+        }
+        return result;
+    }
+
+#endif
+
+} // namespace datapod
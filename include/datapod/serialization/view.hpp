@@ -0,0 +1,329 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "datapod/core/endian.hpp"
+#include "datapod/core/mmap.hpp"
+#include "datapod/core/mode.hpp"
+#include "datapod/core/verify.hpp"
+#include "datapod/pods/memory/ptr.hpp"
+#include "datapod/serialization/serialize.hpp"
+
+namespace datapod {
+
+    // =============================================================================
+    // Zero-copy views
+    // =============================================================================
+    //
+    // serialize_view() writes a cista-style image: the root object's own bytes followed by the
+    // storage of every offset container it reaches, with each self-relative pointer patched to
+    // point inside the image. view<M, T>() validates such a buffer and returns it as T const *
+    // without allocating or copying, so an Mmap'd snapshot is queryable as soon as it is opened.
+    //
+    // Only native byte order and offset-based containers (offset::Vector, offset::String,
+    // offset::Map, offset::Set) can be viewed; raw-pointer members would point nowhere.
+
+    namespace detail {
+        template <typename T> struct offset_vector : std::false_type {};
+        template <typename T, typename Alloc, typename AccessType>
+        struct offset_vector<BasicVector<T, OffsetPtr<T>, Alloc, AccessType>> : std::true_type {
+            using element_type = T;
+        };
+
+        template <typename T> struct offset_hash_storage : std::false_type {};
+        template <typename T, typename GetKey, typename GetValue, typename Hash, typename Eq>
+        struct offset_hash_storage<HashStorage<T, offset::ptr, GetKey, GetValue, Hash, Eq>> : std::true_type {
+            using entry_type = T;
+        };
+
+        template <typename T> struct view_pair : std::false_type {};
+        template <typename A, typename B> struct view_pair<Pair<A, B>> : std::true_type {};
+
+        template <typename T> constexpr bool is_view_compatible() noexcept;
+
+        template <typename Fields, datapod::usize... Is>
+        constexpr bool is_view_compatible_fields(std::index_sequence<Is...>) noexcept {
+            return (is_view_compatible<std::remove_cvref_t<std::tuple_element_t<Is, Fields>>>() && ...);
+        }
+
+        template <typename T> constexpr bool is_view_compatible() noexcept {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+                return true;
+            } else if constexpr (std::is_array_v<T>) {
+                return is_view_compatible<std::remove_cv_t<std::remove_extent_t<T>>>();
+            } else if constexpr (flat_array<T>::value) {
+                return is_view_compatible<typename flat_array<T>::element_type>();
+            } else if constexpr (std::is_same_v<T, offset::String>) {
+                return true;
+            } else if constexpr (offset_vector<T>::value) {
+                return is_view_compatible<typename offset_vector<T>::element_type>();
+            } else if constexpr (offset_hash_storage<T>::value) {
+                return is_view_compatible<typename offset_hash_storage<T>::entry_type>();
+            } else if constexpr (view_pair<T>::value) {
+                return is_view_compatible<typename T::first_type>() && is_view_compatible<typename T::second_type>();
+            } else if constexpr (!std::is_class_v<T> || is_container_v<T>) {
+                return false;
+            } else if constexpr (to_tuple_works_v<T>) {
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return is_view_compatible_fields<Fields>(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return std::is_trivially_copyable_v<T>;
+            }
+        }
+
+        // Control-group width of the hash tables inside T (0 if there are none). The image holds their raw
+        // control bytes, whose layout depends on HashStorage::WIDTH, so the width is part of its version hash.
+        template <typename T> constexpr datapod::usize view_group_width() noexcept;
+
+        template <typename Fields, datapod::usize... Is>
+        constexpr datapod::usize view_group_width_fields(std::index_sequence<Is...>) noexcept {
+            return std::max(
+                {datapod::usize{0}, view_group_width<std::remove_cvref_t<std::tuple_element_t<Is, Fields>>>()...});
+        }
+
+        template <typename T> constexpr datapod::usize view_group_width() noexcept {
+            if constexpr (std::is_array_v<T>) {
+                return view_group_width<std::remove_cv_t<std::remove_extent_t<T>>>();
+            } else if constexpr (flat_array<T>::value) {
+                return view_group_width<typename flat_array<T>::element_type>();
+            } else if constexpr (offset_vector<T>::value) {
+                return view_group_width<typename offset_vector<T>::element_type>();
+            } else if constexpr (offset_hash_storage<T>::value) {
+                return T::WIDTH;
+            } else if constexpr (view_pair<T>::value) {
+                return std::max(view_group_width<typename T::first_type>(),
+                                view_group_width<typename T::second_type>());
+            } else if constexpr (!std::is_class_v<T> || is_container_v<T> || std::is_same_v<T, offset::String>) {
+                return 0U;
+            } else if constexpr (to_tuple_works_v<T>) {
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return view_group_width_fields<Fields>(std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return 0U;
+            }
+        }
+
+        template <typename T> hash_t view_type_hash() noexcept {
+            constexpr auto width = view_group_width<T>();
+            if constexpr (width == 0U) {
+                return type_hash<T>();
+            } else {
+                return hash_combine(type_hash<T>(), hash("hash_storage_width"), width);
+            }
+        }
+
+        template <typename Member, typename Owner> offset_t image_pos(offset_t pos, Owner const &o, Member const &m) {
+            return pos + static_cast<offset_t>(reinterpret_cast<datapod::u8 const *>(&m) -
+                                               reinterpret_cast<datapod::u8 const *>(&o));
+        }
+
+        // Store a self-relative offset from slot to target inside the image
+        template <typename Ctx> void patch_offset(Ctx &ctx, offset_t slot, offset_t target) {
+            ctx.write(slot, static_cast<offset_t>(target - slot));
+        }
+
+        // The bytes of value were already copied to pos; write everything it points to and fix
+        // its offsets so they resolve inside the image.
+        template <typename Ctx, typename T> void write_pointees(Ctx &ctx, T const &value, offset_t pos) {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+                // Nothing to fix
+            } else if constexpr (std::is_array_v<T> || flat_array<T>::value) {
+                for (auto const &el : value) {
+                    write_pointees(ctx, el, image_pos(pos, value, el));
+                }
+            } else if constexpr (std::is_same_v<T, offset::String>) {
+                // SSO strings live inside the object bytes that were already copied
+                auto const *self = reinterpret_cast<char const *>(&value);
+                if (value.data() < self || value.data() >= self + sizeof(value)) {
+                    auto const start = ctx.write(value.data(), value.size() + 1U, 1U);
+                    patch_offset(ctx, image_pos(pos, value, *value.heap_slot()), start);
+                }
+            } else if constexpr (offset_vector<T>::value) {
+                using E = typename offset_vector<T>::element_type;
+                auto members = const_cast<T &>(value).members();
+                auto const slot = image_pos(pos, value, std::get<0>(members));
+                if (value.empty()) {
+                    ctx.write(slot, NULLPTR_OFFSET);
+                } else {
+                    auto const start = ctx.write(value.data(), value.size() * sizeof(E), alignof(E));
+                    for (datapod::usize i = 0U; i != value.size(); ++i) {
+                        write_pointees(ctx, value[i], start + static_cast<offset_t>(i * sizeof(E)));
+                    }
+                    patch_offset(ctx, slot, start);
+                }
+                ctx.write(image_pos(pos, value, std::get<2>(members)), value.size());
+            } else if constexpr (offset_hash_storage<T>::value) {
+                using E = typename offset_hash_storage<T>::entry_type;
+                auto const capacity = static_cast<datapod::usize>(value.capacity_);
+                auto const *ctrl = value.ctrl();
+                auto const entries_slot = image_pos(pos, value, value.entries_);
+                if (capacity == 0U) {
+                    ctx.write(entries_slot, NULLPTR_OFFSET);
+                } else {
+                    // Free slots are written as zeros rather than whatever the allocation held
+                    alignas(E) datapod::u8 const empty[sizeof(E)]{};
+                    auto const start = ctx.write(nullptr, 0U, alignof(E));
+                    for (datapod::usize i = 0U; i != capacity; ++i) {
+                        auto const full = T::is_full(ctrl[i]);
+                        auto const at = ctx.write(full ? static_cast<void const *>(&value.entries()[i]) : empty,
+                                                  sizeof(E), alignof(E));
+                        if (full) {
+                            write_pointees(ctx, value.entries()[i], at);
+                        }
+                    }
+                    patch_offset(ctx, entries_slot, start);
+                }
+                auto const ctrl_start = ctx.write(ctrl, capacity + 1U + T::WIDTH, 1U);
+                patch_offset(ctx, image_pos(pos, value, value.ctrl_), ctrl_start);
+                ctx.write(image_pos(pos, value, value.self_allocated_), false);
+            } else if constexpr (view_pair<T>::value) {
+                write_pointees(ctx, value.first, image_pos(pos, value, value.first));
+                write_pointees(ctx, value.second, image_pos(pos, value, value.second));
+            } else if constexpr (to_tuple_works_v<T>) {
+                for_each_field(const_cast<T &>(value),
+                               [&](auto const &field) { write_pointees(ctx, field, image_pos(pos, value, field)); });
+            }
+        }
+
+        template <typename T>
+        bool in_range(T const *p, datapod::usize n, datapod::u8 const *begin, datapod::u8 const *end) noexcept {
+            auto const addr = reinterpret_cast<std::uintptr_t>(p);
+            auto const b = reinterpret_cast<std::uintptr_t>(begin);
+            auto const e = reinterpret_cast<std::uintptr_t>(end);
+            return addr >= b && addr <= e && addr % alignof(T) == 0U && n <= (e - addr) / sizeof(T);
+        }
+
+        // Bounds-check every offset reachable from value (Mode::DEEP_CHECK)
+        template <typename T> void check_view(T const &value, datapod::u8 const *begin, datapod::u8 const *end) {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+                // Nothing to check
+            } else if constexpr (std::is_array_v<T> || flat_array<T>::value) {
+                for (auto const &el : value) {
+                    check_view(el, begin, end);
+                }
+            } else if constexpr (std::is_same_v<T, offset::String>) {
+                verify(value.size() != offset::String::npos && in_range(value.data(), value.size() + 1U, begin, end),
+                       "view: string out of bounds");
+            } else if constexpr (offset_vector<T>::value) {
+                if (!value.empty()) {
+                    verify(in_range(value.data(), value.size(), begin, end), "view: vector out of bounds");
+                    for (auto const &el : value) {
+                        check_view(el, begin, end);
+                    }
+                }
+            } else if constexpr (offset_hash_storage<T>::value) {
+                auto const capacity = static_cast<datapod::usize>(value.capacity_);
+                verify(((capacity + 1U) & capacity) == 0U && value.size_ <= capacity, "view: corrupt hash table");
+                auto const *ctrl = value.ctrl();
+                verify(in_range(ctrl, capacity + 1U + T::WIDTH, begin, end) && ctrl[capacity] == T::END,
+                       "view: hash table control bytes out of bounds");
+                if (capacity != 0U) {
+                    verify(in_range(value.entries(), capacity, begin, end), "view: hash table entries out of bounds");
+                    for (datapod::usize i = 0U; i != capacity; ++i) {
+                        if (T::is_full(ctrl[i])) {
+                            check_view(value.entries()[i], begin, end);
+                        }
+                    }
+                }
+            } else if constexpr (view_pair<T>::value) {
+                check_view(value.first, begin, end);
+                check_view(value.second, begin, end);
+            } else if constexpr (to_tuple_works_v<T>) {
+                for_each_field(const_cast<T &>(value), [&](auto const &field) { check_view(field, begin, end); });
+            }
+        }
+
+        template <Mode M, typename T, typename Target> void write_view(Target &target, T const &value) {
+            auto ctx = SerializationContext<Target, M>{target};
+
+            offset_t integrity_offset = 0;
+            if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+                hash_t placeholder = 0;
+                integrity_offset = ctx.write(&placeholder, sizeof(hash_t), alignof(hash_t));
+            }
+            if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+                auto const h = view_type_hash<decay_t<T>>();
+                ctx.write(&h, sizeof(h), alignof(hash_t));
+            }
+
+            auto const root = ctx.write(&value, sizeof(T), alignof(T));
+            write_pointees(ctx, value, root);
+
+            if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+                if constexpr (!std::is_same_v<Target, SizeCounter>) {
+                    auto const checksum_start = integrity_offset + static_cast<offset_t>(sizeof(hash_t));
+                    ctx.write(static_cast<datapod::usize>(integrity_offset), target.template checksum<M>(checksum_start));
+                }
+            }
+        }
+    } // namespace detail
+
+    template <typename T> inline constexpr bool is_view_compatible_v = detail::is_view_compatible<decay_t<T>>();
+
+    // Serialize value into a relocatable image that view<M, T>() can use in place
+    template <Mode M = Mode::NONE, typename T> ByteBuf serialize_view(T const &value) {
+        static_assert(is_view_compatible_v<T>, "serialize_view: use offset:: containers for zero-copy views");
+        static_assert(!is_mode_enabled(M, Mode::SERIALIZE_BIG_ENDIAN), "serialize_view: images are native-endian");
+        static_assert(!is_mode_enabled(M, Mode::COMPACT), "serialize_view: images keep the in-memory layout");
+
+        auto counter = SizeCounter{};
+        detail::write_view<M>(counter, value);
+
+        auto b = Buf{};
+        b.allocate(counter.size());
+        detail::write_view<M>(b, value);
+        return b.release();
+    }
+
+    // Reinterpret an image produced by serialize_view<M>() as T without copying
+    // The buffer must stay alive and unmodified, and be aligned at least to alignof(T).
+    // Headers are always validated; Mode::DEEP_CHECK also bounds-checks every offset.
+    template <Mode M = Mode::NONE, typename T> T const *view(datapod::u8 const *data, datapod::usize size) {
+        static_assert(is_view_compatible_v<T>, "view: use offset:: containers for zero-copy views");
+        static_assert(!is_mode_enabled(M, Mode::SERIALIZE_BIG_ENDIAN), "view: images are native-endian");
+        static_assert(!is_mode_enabled(M, Mode::COMPACT), "view: images keep the in-memory layout");
+
+        auto ctx = DeserializationContext<M>{data, size};
+
+        if constexpr (is_mode_enabled(M, Mode::WITH_INTEGRITY)) {
+            hash_t stored_checksum;
+            ctx.align(alignof(hash_t));
+            auto const checksum_start = ctx.pos_ + sizeof(hash_t);
+            ctx.read(&stored_checksum, sizeof(hash_t));
+            if constexpr (is_mode_disabled(M, Mode::SKIP_INTEGRITY)) {
+                auto const calculated_checksum = integrity_checksum<M>(data + checksum_start, size - checksum_start);
+                verify(stored_checksum == calculated_checksum, "integrity check failed: data corrupted");
+            }
+        }
+
+        if constexpr (is_mode_enabled(M, Mode::WITH_VERSION)) {
+            hash_t stored_hash;
+            ctx.align(alignof(hash_t));
+            ctx.read(&stored_hash, sizeof(hash_t));
+            if constexpr (is_mode_disabled(M, Mode::SKIP_VERSION)) {
+                verify(stored_hash == detail::view_type_hash<decay_t<T>>(), "version mismatch: type schema changed");
+            }
+        }
+
+        ctx.align(alignof(T));
+        verify(ctx.pos_ + sizeof(T) <= size, "view: buffer too small");
+        verify(is_aligned(data + ctx.pos_, alignof(T)), "view: buffer not sufficiently aligned");
+
+        auto const *root = reinterpret_cast<T const *>(data + ctx.pos_);
+        if constexpr (is_mode_enabled(M, Mode::DEEP_CHECK)) {
+            detail::check_view(*root, data, data + size);
+        }
+        return root;
+    }
+
+    template <Mode M = Mode::NONE, typename T> T const *view(ByteBuf const &buf) {
+        return view<M, T>(buf.data(), buf.size());
+    }
+
+    template <Mode M = Mode::NONE, typename T> T const *view(Mmap const &mmap) {
+        return view<M, T>(mmap.data(), mmap.size());
+    }
+
+} // namespace datapod
@@ -23,11 +23,23 @@
 
 namespace datapod {
 
-    template <typename T> hash_t type2str_hash() noexcept {
-        return hash_combine(hash(canonical_type_str<decay_t<T>>()), sizeof(T));
+    template <typename T> constexpr hash_t type2str_hash() noexcept {
+        return hash_combine(hash(canonical_type_name_v<decay_t<T>>.view()), sizeof(T));
     }
 
-    template <typename T> hash_t type_hash(T const &, hash_t, Map<hash_t, unsigned> &) noexcept;
+    namespace detail {
+        // Stands in for a T when looking for a custom type_hash(T const &, ...) overload
+        template <typename T> struct TypeHashProbe {
+            operator T const &() const noexcept;
+        };
+
+        template <typename T> struct is_type_hash_probe : std::false_type {};
+        template <typename T> struct is_type_hash_probe<TypeHashProbe<T>> : std::true_type {};
+    } // namespace detail
+
+    template <typename T>
+        requires(!detail::is_type_hash_probe<T>::value)
+    hash_t type_hash(T const &, hash_t, Map<hash_t, unsigned> &) noexcept;
 
     // Array specialization
     template <typename T, datapod::usize Size>
@@ -38,7 +50,9 @@ namespace datapod {
     }
 
     // Base template - handles pointers, primitives, scalars, and aggregates
-    template <typename T> hash_t type_hash(T const &el, hash_t h, Map<hash_t, unsigned> &done) noexcept {
+    template <typename T>
+        requires(!detail::is_type_hash_probe<T>::value)
+    hash_t type_hash(T const &el, hash_t h, Map<hash_t, unsigned> &done) noexcept {
         using Type = decay_t<T>;
 
         auto const base_hash = type2str_hash<Type>();
@@ -124,7 +138,7 @@ namespace datapod {
     hash_t type_hash(Strong<T, Tag> const &, hash_t h, Map<hash_t, unsigned> &done) noexcept {
         h = hash_combine(h, hash("strong"));
         h = type_hash(T{}, h, done);
-        h = hash_combine(hash(canonical_type_str<Tag>()), h);
+        h = hash_combine(hash(canonical_type_name_v<Tag>.view()), h);
         return h;
     }
 
@@ -135,10 +149,237 @@ namespace datapod {
         return h;
     }
 
+    // =============================================================================
+    // Compile-time type hash
+    // =============================================================================
+    //
+    // Mirrors the overloads above on types instead of values, so the whole walk runs at compile
+    // time. The visited-type Map becomes a fixed array of base hashes with the same first-visit
+    // numbering, so both walks produce identical hashes.
+
+    namespace detail {
+        struct TypeHashDone {
+            static constexpr datapod::usize CAPACITY = 256U;
+
+            constexpr datapod::usize find(hash_t const key) const noexcept {
+                for (auto i = datapod::usize{}; i != size_; ++i) {
+                    if (keys_[i] == key) {
+                        return i;
+                    }
+                }
+                return CAPACITY;
+            }
+
+            hash_t keys_[CAPACITY]{};
+            datapod::usize size_{0U};
+        };
+
+        template <typename T> struct is_type_hash_vector : std::false_type {};
+        template <typename T, typename Ptr, typename Alloc>
+        struct is_type_hash_vector<BasicVector<T, Ptr, Alloc>> : std::true_type {
+            using element_type = T;
+        };
+
+        template <typename T> struct is_type_hash_unique_ptr : std::false_type {};
+        template <typename T, typename Ptr> struct is_type_hash_unique_ptr<UniquePtr<T, Ptr>> : std::true_type {
+            using element_type = T;
+        };
+
+        template <typename T> struct is_type_hash_storage : std::false_type {};
+        template <typename T, template <typename> typename Ptr, typename GetKey, typename GetValue, typename Hash,
+                  typename Eq>
+        struct is_type_hash_storage<HashStorage<T, Ptr, GetKey, GetValue, Hash, Eq>> : std::true_type {
+            using element_type = T;
+        };
+
+        template <typename T> struct is_type_hash_string : std::false_type {};
+        template <typename Ptr> struct is_type_hash_string<BasicString<Ptr>> : std::true_type {};
+
+        template <typename T> struct is_type_hash_array : std::false_type {};
+        template <typename T, datapod::usize Size> struct is_type_hash_array<Array<T, Size>> : std::true_type {
+            using element_type = T;
+            static constexpr datapod::usize size = Size;
+        };
+
+        template <typename T> struct is_type_hash_strong : std::false_type {};
+        template <typename T, typename Tag> struct is_type_hash_strong<Strong<T, Tag>> : std::true_type {
+            using value_type = T;
+            using tag_type = Tag;
+        };
+
+        template <typename T> struct is_type_hash_pack : std::false_type {};
+        template <typename... Ts> struct is_type_hash_pack<Variant<Ts...>> : std::true_type {
+            static constexpr std::string_view name = "variant";
+            using types = std::tuple<Ts...>;
+        };
+        template <typename... Ts> struct is_type_hash_pack<Tuple<Ts...>> : std::true_type {
+            static constexpr std::string_view name = "tuple";
+            using types = std::tuple<Ts...>;
+        };
+
+        template <typename T> struct is_type_hash_pair : std::false_type {};
+        template <typename A, typename B> struct is_type_hash_pair<Pair<A, B>> : std::true_type {};
+
+        template <typename T> struct is_type_hash_optional : std::false_type {};
+        template <typename T> struct is_type_hash_optional<Optional<T>> : std::true_type {
+            using value_type = T;
+        };
+
+        namespace type_hash_adl {
+            void type_hash() = delete; // Hides datapod::type_hash, leaving only what ADL finds
+
+            // Whether T has a type_hash() overload of its own, which only the runtime walk calls
+            // The probe converts to T const & but deduces none of the overloads above, so only a
+            // non-template overload taking T matches.
+            template <typename T>
+            concept has_overload =
+                (std::is_class_v<T> || std::is_enum_v<T>) &&
+                requires(TypeHashProbe<T> const &el, hash_t h, Map<hash_t, unsigned> &done) { type_hash(el, h, done); };
+        } // namespace type_hash_adl
+
+        template <typename T, typename... Seen> constexpr bool static_type_hashable() noexcept;
+
+        template <typename Tuple, typename... Seen, datapod::usize... Is>
+        constexpr bool static_type_hashable_all(std::index_sequence<Is...>) noexcept {
+            return (static_type_hashable<decay_t<std::tuple_element_t<Is, Tuple>>, Seen...>() && ...);
+        }
+
+        // Whether every type reachable from T is covered by static_type_hash (Seen breaks cycles)
+        template <typename T, typename... Seen> constexpr bool static_type_hashable() noexcept {
+            if constexpr ((std::is_same_v<T, Seen> || ...)) {
+                return true;
+            } else if constexpr (type_hash_adl::has_overload<T>) {
+                return false;
+            } else if constexpr (std::is_pointer_v<T>) {
+                using Pointee = std::remove_pointer_t<T>;
+                return std::is_same_v<Pointee, void> || static_type_hashable<decay_t<Pointee>, T, Seen...>();
+            } else if constexpr (std::is_scalar_v<T> || is_type_hash_string<T>::value) {
+                return true;
+            } else if constexpr (is_type_hash_array<T>::value) {
+                return static_type_hashable<typename is_type_hash_array<T>::element_type, T, Seen...>();
+            } else if constexpr (is_type_hash_vector<T>::value) {
+                return static_type_hashable<typename is_type_hash_vector<T>::element_type, T, Seen...>();
+            } else if constexpr (is_type_hash_unique_ptr<T>::value) {
+                return static_type_hashable<typename is_type_hash_unique_ptr<T>::element_type, T, Seen...>();
+            } else if constexpr (is_type_hash_storage<T>::value) {
+                return static_type_hashable<typename is_type_hash_storage<T>::element_type, T, Seen...>();
+            } else if constexpr (is_type_hash_optional<T>::value) {
+                return static_type_hashable<typename is_type_hash_optional<T>::value_type, T, Seen...>();
+            } else if constexpr (is_type_hash_strong<T>::value) {
+                return static_type_hashable<typename is_type_hash_strong<T>::value_type, T, Seen...>();
+            } else if constexpr (is_type_hash_pair<T>::value) {
+                return static_type_hashable<typename T::first_type, T, Seen...>() &&
+                       static_type_hashable<typename T::second_type, T, Seen...>();
+            } else if constexpr (is_type_hash_pack<T>::value) {
+                using Types = typename is_type_hash_pack<T>::types;
+                return static_type_hashable_all<Types, T, Seen...>(
+                    std::make_index_sequence<std::tuple_size_v<Types>>{});
+            } else if constexpr (to_tuple_works_v<T> && (std::is_aggregate_v<T> || has_members_v<T>)) {
+                // Non-aggregates without members() reflect as empty and usually carry a custom overload
+                using Fields = decltype(to_tuple(std::declval<T &>()));
+                return static_type_hashable_all<Fields, T, Seen...>(
+                    std::make_index_sequence<std::tuple_size_v<Fields>>{});
+            } else {
+                return false;
+            }
+        }
+
+        template <typename T> constexpr hash_t static_type_hash(hash_t h, TypeHashDone &done) noexcept;
+
+        template <typename Tuple, datapod::usize... Is>
+        constexpr hash_t static_type_hash_all(hash_t h, TypeHashDone &done, std::index_sequence<Is...>) noexcept {
+            ((h = static_type_hash<decay_t<std::tuple_element_t<Is, Tuple>>>(h, done)), ...);
+            return h;
+        }
+
+        template <typename T> constexpr hash_t static_type_hash(hash_t h, TypeHashDone &done) noexcept {
+            if constexpr (is_type_hash_array<T>::value) {
+                h = hash_combine(h, hash("array"));
+                h = hash_combine(h, is_type_hash_array<T>::size);
+                return static_type_hash<typename is_type_hash_array<T>::element_type>(h, done);
+            } else if constexpr (is_type_hash_pair<T>::value) {
+                h = static_type_hash<typename T::first_type>(h, done);
+                h = static_type_hash<typename T::second_type>(h, done);
+                return hash_combine(h, hash("pair"));
+            } else if constexpr (is_type_hash_vector<T>::value) {
+                h = hash_combine(h, hash("vector"));
+                return static_type_hash<typename is_type_hash_vector<T>::element_type>(h, done);
+            } else if constexpr (is_type_hash_unique_ptr<T>::value) {
+                h = hash_combine(h, hash("unique_ptr"));
+                return static_type_hash<typename is_type_hash_unique_ptr<T>::element_type>(h, done);
+            } else if constexpr (is_type_hash_storage<T>::value) {
+                h = hash_combine(h, hash("hash_storage"));
+                return static_type_hash<typename is_type_hash_storage<T>::element_type>(h, done);
+            } else if constexpr (is_type_hash_pack<T>::value) {
+                using Types = typename is_type_hash_pack<T>::types;
+                h = hash_combine(h, hash(is_type_hash_pack<T>::name));
+                return static_type_hash_all<Types>(h, done, std::make_index_sequence<std::tuple_size_v<Types>>{});
+            } else if constexpr (is_type_hash_string<T>::value) {
+                return hash_combine(h, hash("string"));
+            } else if constexpr (is_type_hash_strong<T>::value) {
+                h = hash_combine(h, hash("strong"));
+                h = static_type_hash<typename is_type_hash_strong<T>::value_type>(h, done);
+                return hash_combine(hash(canonical_type_name_v<typename is_type_hash_strong<T>::tag_type>.view()), h);
+            } else if constexpr (is_type_hash_optional<T>::value) {
+                h = hash_combine(h, hash("optional"));
+                return static_type_hash<typename is_type_hash_optional<T>::value_type>(h, done);
+            } else {
+                auto const base_hash = type2str_hash<T>();
+                auto const index = done.find(base_hash);
+                if (index != TypeHashDone::CAPACITY) {
+                    return hash_combine(h, static_cast<unsigned>(index));
+                }
+                done.keys_[done.size_] = base_hash;
+                ++done.size_;
+
+                if constexpr (std::is_pointer_v<T>) {
+                    using Pointee = std::remove_pointer_t<T>;
+                    if constexpr (std::is_same_v<Pointee, void>) {
+                        return hash_combine(h, hash("void*"));
+                    } else {
+                        return static_type_hash<decay_t<Pointee>>(hash_combine(h, hash("pointer")), done);
+                    }
+                } else if constexpr (has_primitive_type_id_v<T>) {
+                    return hash_combine(h, primitive_type_id<T>::id);
+                } else if constexpr (std::is_scalar_v<T>) {
+                    return hash_combine(h, type2str_hash<T>());
+                } else {
+                    using Fields = decltype(to_tuple(std::declval<T &>()));
+                    h = hash_combine(h, hash("struct"));
+                    return static_type_hash_all<Fields>(h, done,
+                                                        std::make_index_sequence<std::tuple_size_v<Fields>>{});
+                }
+            }
+        }
+    } // namespace detail
+
+    template <typename T>
+    inline constexpr bool is_static_type_hashable_v = detail::static_type_hashable<decay_t<T>>();
+
+    // Type hash evaluated entirely at compile time
+    template <typename T> consteval hash_t static_type_hash() {
+        static_assert(is_static_type_hashable_v<T>, "Type hash needs a custom type_hash() overload");
+        auto done = detail::TypeHashDone{};
+        return detail::static_type_hash<decay_t<T>>(BASE_HASH, done);
+    }
+
+    template <typename T> inline constexpr hash_t type_hash_v = static_type_hash<T>();
+
     // Entry point: compute type hash for a type
+    // A compile-time constant when reflection covers the whole type graph; otherwise the runtime
+    // walk (which picks up custom type_hash() overloads) runs once and is cached. A reflectable type
+    // with a non-template type_hash(T const &, hash_t, Map<hash_t, unsigned> &) overload goes through
+    // the runtime walk too; overload templates (say, for every Wrapper<U>) are not detected.
     template <typename T> hash_t type_hash() {
-        auto done = Map<hash_t, unsigned>{};
-        return type_hash(T{}, BASE_HASH, done);
+        if constexpr (is_static_type_hashable_v<T>) {
+            return type_hash_v<T>;
+        } else {
+            static hash_t const h = [] {
+                auto done = Map<hash_t, unsigned>{};
+                return type_hash(T{}, BASE_HASH, done);
+            }();
+            return h;
+        }
     }
 
 } // namespace datapod
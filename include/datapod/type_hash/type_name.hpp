@@ -51,11 +51,46 @@ namespace datapod {
         return sig;
     }
 
+    // Type name with the canonicalize_type_name() removals applied, built at compile time
+    template <datapod::usize N> struct CanonicalTypeName {
+        constexpr std::string_view view() const noexcept { return {chars_, size_}; }
+
+        // Same semantics as remove_all(std::string &, std::string_view)
+        constexpr void remove_all(std::string_view substr) noexcept {
+            auto pos = datapod::usize{};
+            while ((pos = view().find(substr, pos)) != std::string_view::npos) {
+                for (auto i = pos; i + substr.size() < size_; ++i) {
+                    chars_[i] = chars_[i + substr.size()];
+                }
+                size_ -= substr.size();
+            }
+        }
+
+        char chars_[N + 1U]{};
+        datapod::usize size_{0U};
+    };
+
+    template <typename T> constexpr auto canonical_type_name() {
+        constexpr auto base = type_str<T>();
+        auto name = CanonicalTypeName<base.size()>{};
+        for (auto i = datapod::usize{}; i != base.size(); ++i) {
+            name.chars_[i] = base[i];
+        }
+        name.size_ = base.size();
+        name.remove_all("{anonymous}::");           // GCC
+        name.remove_all("(anonymous namespace)::"); // Clang
+        name.remove_all("`anonymous-namespace'::"); // MSVC
+        name.remove_all("struct");                  // MSVC "struct my_struct" vs "my_struct"
+        name.remove_all("const");                   // MSVC "char const*"" vs "const char*"
+        name.remove_all(" ");                       // MSVC
+        return name;
+    }
+
+    template <typename T> inline constexpr auto canonical_type_name_v = canonical_type_name<T>();
+
     template <typename T> std::string canonical_type_str() {
-        auto const base = type_str<T>();
-        std::string s{base.data(), base.length()};
-        canonicalize_type_name(s);
-        return s;
+        auto const name = canonical_type_name_v<T>.view();
+        return std::string{name.data(), name.size()};
     }
 
 } // namespace datapod
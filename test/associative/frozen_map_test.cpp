@@ -0,0 +1,142 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace datapod;
+
+struct Catalog {
+    datapod::u32 version;
+    offset::FrozenMap<offset::String, datapod::u32> ids;
+};
+
+TEST_SUITE("FrozenMap") {
+
+    TEST_CASE("Build from Map") {
+        Map<datapod::u32, datapod::u64> map;
+        for (datapod::u32 i = 0; i < 10000; ++i) {
+            map[i * 7U] = datapod::u64{i} * i;
+        }
+
+        auto const frozen = frozen_map::make(map);
+        CHECK(frozen.size() == map.size());
+        CHECK(frozen.pilots_.size() == (map.size() + 2U) / 3U);
+        for (datapod::u32 i = 0; i < 10000; ++i) {
+            auto const it = frozen.find(i * 7U);
+            REQUIRE(it != frozen.end());
+            CHECK(it->first == i * 7U);
+            CHECK(it->second == datapod::u64{i} * i);
+        }
+        for (datapod::u32 i = 0; i < 10000; ++i) {
+            CHECK_FALSE(frozen.contains(i * 7U + 1U));
+        }
+        CHECK(frozen.count(14U) == 1);
+        CHECK(frozen.count(15U) == 0);
+        CHECK(frozen.at(21U) == 9U);
+        CHECK_THROWS_AS(frozen.at(22U), std::out_of_range);
+        CHECK(frozen.get(28U).value() == 16U);
+        CHECK_FALSE(frozen.get(29U).has_value());
+
+        // Every entry appears exactly once, in slot order
+        datapod::u64 sum = 0;
+        for (auto const &[k, v] : frozen) {
+            CHECK(map.at(k) == v);
+            sum += k;
+        }
+        CHECK(sum == 7ULL * 9999ULL * 10000ULL / 2ULL);
+    }
+
+    TEST_CASE("Small and empty tables") {
+        FrozenMap<int, int> const empty = FrozenMap<int, int>::build(Map<int, int>{});
+        CHECK(empty.empty());
+        CHECK(empty.begin() == empty.end());
+        CHECK_FALSE(empty.contains(0));
+
+        for (int n = 1; n < 40; ++n) {
+            Map<int, int> map;
+            for (int i = 0; i < n; ++i) {
+                map[-i] = i;
+            }
+            auto const frozen = frozen_map::make(map);
+            REQUIRE(frozen.size() == static_cast<datapod::usize>(n));
+            for (int i = 0; i < n; ++i) {
+                CHECK(frozen.at(-i) == i);
+            }
+            CHECK_FALSE(frozen.contains(1));
+        }
+    }
+
+    TEST_CASE("Build from any range of pairs") {
+        std::vector<Pair<int, int>> const entries{{1, 10}, {2, 20}, {3, 30}};
+        auto const frozen = FrozenMap<int, int>::build(entries, 12345U);
+        CHECK(frozen.seed_ == 12345U);
+        CHECK(frozen.at(2) == 20);
+
+        std::vector<Pair<int, int>> const duplicates{{1, 10}, {2, 20}, {1, 30}};
+        CHECK_THROWS_AS((FrozenMap<int, int>::build(duplicates)), std::invalid_argument);
+    }
+
+    TEST_CASE("String keys and string_view lookup") {
+        Map<String, int> map;
+        for (int i = 0; i < 500; ++i) {
+            map[String(("joint_" + std::to_string(i)).c_str())] = i;
+        }
+        auto const frozen = frozen_map::make(map);
+        CHECK(frozen.at(String("joint_42")) == 42);
+        CHECK(frozen.at(std::string_view{"joint_499"}) == 499);
+        CHECK(frozen.at("joint_0") == 0);
+        CHECK_FALSE(frozen.contains(std::string_view{"joint_500"}));
+    }
+
+    TEST_CASE("Serialize round trip") {
+        Map<String, Vector<int>> map;
+        for (int i = 0; i < 300; ++i) {
+            map[String(("sensor_" + std::to_string(i)).c_str())] = Vector<int>{i, i + 1};
+        }
+        auto const frozen = frozen_map::make(map);
+
+        auto buf = serialize(frozen);
+        auto const copy = deserialize<Mode::NONE, FrozenMap<String, Vector<int>>>(buf);
+        REQUIRE(copy.size() == 300);
+        CHECK(copy.seed_ == frozen.seed_);
+        for (int i = 0; i < 300; ++i) {
+            auto const it = copy.find(std::string_view{"sensor_" + std::to_string(i)});
+            REQUIRE(it != copy.end());
+            CHECK(it->second[1] == i + 1);
+        }
+        CHECK_FALSE(copy.contains("sensor_300"));
+    }
+
+    TEST_CASE("Zero-copy view of offset::FrozenMap") {
+        Map<String, datapod::u32> map;
+        for (datapod::u32 i = 0; i < 1000; ++i) {
+            map[String(("a key long enough to leave the small string buffer " + std::to_string(i)).c_str())] = i;
+        }
+        Catalog c;
+        c.version = 3;
+        c.ids = offset::FrozenMap<offset::String, datapod::u32>::build(map);
+        CHECK(is_view_compatible_v<Catalog>);
+
+        auto buf = serialize_view(c);
+        auto const *v = view<Mode::NONE, Catalog>(buf);
+        REQUIRE(v != nullptr);
+        CHECK(v->version == 3);
+        REQUIRE(v->ids.size() == 1000);
+        for (datapod::u32 i = 0; i < 1000; ++i) {
+            auto const key = "a key long enough to leave the small string buffer " + std::to_string(i);
+            CHECK(v->ids.at(std::string_view{key}) == i);
+        }
+        CHECK_FALSE(v->ids.contains("missing"));
+
+        // The table lives inside the buffer
+        auto const *first = reinterpret_cast<datapod::u8 const *>(v->ids.begin());
+        CHECK(first >= buf.data());
+        CHECK(first < buf.data() + buf.size());
+
+        constexpr auto MODE = Mode::WITH_VERSION | Mode::WITH_INTEGRITY | Mode::DEEP_CHECK;
+        auto checked = serialize_view<MODE>(c);
+        CHECK(view<MODE, Catalog>(checked)->ids.at("a key long enough to leave the small string buffer 7") == 7U);
+    }
+}
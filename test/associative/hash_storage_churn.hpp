@@ -0,0 +1,39 @@
+#pragma once
+
+#include <doctest/doctest.h>
+
+#include <random>
+#include <unordered_map>
+
+#include "datapod/types/types.hpp"
+
+// Random inserts and erases checked against std::unordered_map every 97 steps
+// Crosses every small capacity (where groups read mirrored control bytes) and leaves DELETED
+// slots behind. Shared by the tests built with SIMD and with SWAR control groups.
+template <typename MapType> void check_churn_matches_std(datapod::u64 const seed) {
+    MapType m;
+    std::unordered_map<datapod::u64, datapod::u64> ref;
+    std::mt19937_64 rng{seed};
+    for (int step = 0; step < 20000; ++step) {
+        auto const key = rng() % 512U;
+        if (rng() % 3U == 0U) {
+            CHECK(m.erase(key) == ref.erase(key));
+        } else {
+            m[key] = static_cast<datapod::u64>(step);
+            ref[key] = static_cast<datapod::u64>(step);
+        }
+        if (step % 97 == 0) {
+            REQUIRE(m.size() == ref.size());
+            datapod::usize seen = 0;
+            for (auto const &kv : m) {
+                REQUIRE(ref.count(kv.first) == 1U);
+                CHECK(ref[kv.first] == kv.second);
+                ++seen;
+            }
+            CHECK(seen == ref.size());
+            for (datapod::u64 k = 0; k < 512U; ++k) {
+                CHECK(m.contains(k) == (ref.count(k) == 1U));
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#include <doctest/doctest.h>
+
+// Forces the portable 8-wide control groups that non-SIMD targets use
+#define DATAPOD_HASH_NO_SIMD
+#include "datapod/pods/associative/map.hpp"
+#include "datapod/pods/associative/set.hpp"
+#include "datapod/pods/sequential/string.hpp"
+#include "hash_storage_churn.hpp"
+
+using namespace datapod;
+
+TEST_SUITE("HashStorage SWAR groups") {
+    TEST_CASE("Group width") {
+        CHECK(Map<int, int>::WIDTH == 8U);
+        CHECK(Set<int>::WIDTH == 8U);
+    }
+
+    TEST_CASE("Insert/erase churn matches std::unordered_map") {
+        check_churn_matches_std<Map<datapod::u64, datapod::u64>>(7U);
+    }
+
+    TEST_CASE("String keys") {
+        Set<String> s;
+        for (int i = 0; i < 1000; ++i) {
+            s.insert(String(std::to_string(i).c_str()));
+        }
+        CHECK(s.size() == 1000U);
+        CHECK(s.contains(String("999")));
+        CHECK_FALSE(s.contains(String("1000")));
+    }
+}
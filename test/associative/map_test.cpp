@@ -1,6 +1,11 @@
 #include <doctest/doctest.h>
 
 #include "datapod/datapod.hpp"
+#include "hash_storage_churn.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace datapod;
 
@@ -431,4 +436,106 @@ TEST_SUITE("Map") {
         // The fact that this compiles means members() works
         CHECK(true);
     }
+
+    TEST_CASE("Insert/erase churn matches std::unordered_map") {
+        check_churn_matches_std<Map<datapod::u64, datapod::u64>>(42U);
+    }
+
+    TEST_CASE("find_batch / contains_batch") {
+        Map<datapod::u64, datapod::u64> m;
+        for (datapod::u64 i = 0; i < 1000; i += 2) {
+            m[i] = i * 10;
+        }
+
+        // Not a multiple of the block size, with hits and misses interleaved
+        std::vector<datapod::u64> keys;
+        for (datapod::u64 i = 0; i < 37; ++i) {
+            keys.push_back(i * 7);
+        }
+        std::vector<Map<datapod::u64, datapod::u64>::iterator> found(keys.size());
+        m.find_batch(keys, found);
+        for (datapod::usize i = 0; i < keys.size(); ++i) {
+            CHECK((found[i] == m.find(keys[i])));
+            if (keys[i] % 2 == 0) {
+                CHECK(found[i]->second == keys[i] * 10);
+            }
+        }
+
+        bool present[37];
+        CHECK(m.contains_batch(keys, present) == 19U);
+        for (datapod::usize i = 0; i < keys.size(); ++i) {
+            CHECK(present[i] == (keys[i] % 2 == 0));
+        }
+
+        auto const &cm = m;
+        std::vector<Map<datapod::u64, datapod::u64>::const_iterator> cfound(keys.size());
+        cm.find_batch(keys, cfound);
+        CHECK((cfound[2] == cm.find(keys[2])));
+
+        CHECK_THROWS_AS(m.contains_batch(keys, std::span<bool>(present, 3)), std::length_error);
+
+        Map<datapod::u64, datapod::u64> empty;
+        empty.find_batch(keys, found);
+        CHECK((found[0] == empty.end()));
+        CHECK(empty.contains_batch(keys, present) == 0U);
+    }
+
+    TEST_CASE("Precomputed hash overloads") {
+        Map<datapod::u64, String> a;
+        Map<datapod::u64, String> b;
+        auto const h = a.hash_of(datapod::u64{42});
+        CHECK(h == b.hash_of(datapod::u64{42}));
+
+        CHECK_FALSE(a.contains(datapod::u64{42}, h));
+        auto const [it, inserted] = a.emplace_hint_hash(h, datapod::u64{42}, String("answer"));
+        CHECK(inserted);
+        CHECK(it->second == String("answer"));
+        CHECK_FALSE(a.emplace_hint_hash(h, datapod::u64{42}, String("again")).second);
+        CHECK(a.size() == 1);
+
+        // One hash serves every table with the same Hash
+        b.emplace_hint_hash(h, datapod::u64{42}, String("other"));
+        CHECK((a.find(datapod::u64{42}, h) == a.find(datapod::u64{42})));
+        CHECK(b.find(datapod::u64{42}, h)->second == String("other"));
+
+        auto const &ca = a;
+        CHECK(ca.find(datapod::u64{42}, h)->second == String("answer"));
+
+        CHECK(a.erase(datapod::u64{42}, h) == 1U);
+        CHECK(a.erase(datapod::u64{42}, h) == 0U);
+        CHECK(a.empty());
+
+        // Still correct across rehashes
+        for (datapod::u64 i = 0; i < 1000; ++i) {
+            a.emplace_hint_hash(a.hash_of(i), i, String("v"));
+        }
+        for (datapod::u64 i = 0; i < 1000; ++i) {
+            CHECK(a.contains(i, a.hash_of(i)));
+        }
+    }
+
+    TEST_CASE("Transparent string_view lookup") {
+        Map<String, int> m;
+        m[String("a rather long key that does not fit in SSO")] = 1;
+        m[String("short")] = 2;
+
+        std::string_view const sv = "a rather long key that does not fit in SSO";
+        CHECK(m.hash_of(sv) == m.hash_of(String(sv)));
+        CHECK(m.hash_of("short") == m.hash_of(String("short")));
+        CHECK(m.hash_of(std::string("short")) == m.hash_of(String("short")));
+
+        CHECK(m.contains(sv));
+        CHECK(m.find(sv)->second == 1);
+        CHECK(m.find(std::string("short"))->second == 2);
+        CHECK(m.contains("short"));
+        CHECK_FALSE(m.contains(std::string_view("shor")));
+        CHECK(m.at(std::string_view("short")) == 2);
+
+        auto const h = m.hash_of(sv);
+        CHECK(m.contains(sv, h));
+        CHECK(m.erase(sv, h) == 1U);
+        CHECK_FALSE(m.contains(sv));
+        CHECK(m.erase(std::string_view("short")) == 1U);
+        CHECK(m.empty());
+    }
 }
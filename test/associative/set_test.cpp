@@ -460,4 +460,14 @@ TEST_SUITE("Set") {
         }
     }
 
+    TEST_CASE("contains_batch with String keys") {
+        Set<String> s{String("left"), String("right"), String("front")};
+        String const keys[] = {String("front"), String("back"), String("left")};
+        bool present[3];
+        CHECK(s.contains_batch(keys, present) == 2U);
+        CHECK(present[0]);
+        CHECK_FALSE(present[1]);
+        CHECK(present[2]);
+    }
+
 } // TEST_SUITE("Set")
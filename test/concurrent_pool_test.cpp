@@ -0,0 +1,173 @@
+#include <doctest/doctest.h>
+
+#include "datapod/pods/lockfree/ring_buffer.hpp"
+#include "datapod/pods/memory/concurrent_pool.hpp"
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+struct Message {
+    datapod::u64 seq;
+    datapod::u64 payload[7];
+};
+
+TEST_SUITE("ConcurrentPool") {
+    TEST_CASE("CacheAllocateDeallocate") {
+        ConcurrentPool<Message> pool(16, 4);
+        CHECK(pool.chunk_count() == 0);
+        {
+            ConcurrentPool<Message>::Cache cache(pool);
+            std::set<Message *> seen;
+            std::vector<Message *> live;
+            for (int i = 0; i < 16; ++i) {
+                Message *m = cache.allocate();
+                CHECK(seen.insert(m).second);
+                CHECK(reinterpret_cast<uintptr_t>(m) % alignof(Message) == 0);
+                live.push_back(m);
+            }
+            CHECK(pool.chunk_count() == 1);
+            CHECK(pool.capacity() == 16);
+
+            // A 17th block needs a second, twice as large chunk
+            live.push_back(cache.allocate());
+            CHECK(pool.chunk_count() == 2);
+            CHECK(pool.capacity() == 48);
+
+            for (Message *m : live) {
+                cache.deallocate(m);
+            }
+            // Never more than two batches stay in the cache
+            CHECK(cache.cached() < 2 * pool.batch_size());
+        }
+        // The cache returned everything; reuse does not grow the pool
+        ConcurrentPool<Message>::Cache again(pool);
+        for (int i = 0; i < 48; ++i) {
+            again.allocate();
+        }
+        CHECK(pool.chunk_count() == 2);
+    }
+
+    TEST_CASE("CreateDestroy") {
+        ConcurrentPool<std::vector<int>> pool;
+        auto *v = pool.create(3, 7);
+        CHECK(v->size() == 3);
+        CHECK((*v)[2] == 7);
+        pool.destroy(v);
+
+        ConcurrentPool<std::vector<int>>::Cache cache(pool);
+        auto *w = cache.create(5);
+        CHECK(w->size() == 5);
+        cache.destroy(w);
+    }
+
+    TEST_CASE("CachelessAllocation") {
+        ConcurrentPool<int> pool(8, 4);
+        std::set<int *> seen;
+        std::vector<int *> live;
+        for (int i = 0; i < 100; ++i) {
+            int *p = pool.allocate();
+            CHECK(seen.insert(p).second);
+            *p = i;
+            live.push_back(p);
+        }
+        for (int i = 0; i < 100; ++i) {
+            CHECK(*live[i] == i);
+            pool.deallocate(live[i]);
+        }
+        auto const capacity = pool.capacity();
+        for (int i = 0; i < 100; ++i) {
+            live[i] = pool.allocate();
+        }
+        CHECK(pool.capacity() == capacity);
+    }
+
+    TEST_CASE("CrossThreadRecycling") {
+        // A driver allocates messages, workers free them: blocks flow back through the shared list
+        constexpr datapod::u64 N = 100000;
+        constexpr int WORKERS = 3;
+        ConcurrentPool<Message> pool(64, 16);
+        RingBuffer<MPMC, Message *> queue(256);
+        std::atomic<datapod::u64> received{0};
+        std::atomic<datapod::u64> checksum{0};
+        std::atomic<bool> ok{true};
+
+        std::vector<std::thread> workers;
+        for (int w = 0; w < WORKERS; ++w) {
+            workers.emplace_back([&] {
+                ConcurrentPool<Message>::Cache cache(pool);
+                datapod::u64 sum = 0;
+                while (received.load(std::memory_order_relaxed) < N) {
+                    auto m = queue.try_pop();
+                    if (!m.has_value()) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (auto word : (*m)->payload) {
+                        if (word != (*m)->seq) {
+                            ok = false;
+                        }
+                    }
+                    sum += (*m)->seq;
+                    cache.deallocate(*m);
+                    received.fetch_add(1, std::memory_order_relaxed);
+                }
+                checksum.fetch_add(sum);
+            });
+        }
+
+        {
+            ConcurrentPool<Message>::Cache cache(pool);
+            for (datapod::u64 i = 0; i < N; ++i) {
+                Message *m = cache.allocate();
+                m->seq = i;
+                for (auto &word : m->payload) {
+                    word = i;
+                }
+                while (!queue.try_push(m)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        for (auto &t : workers) {
+            t.join();
+        }
+
+        CHECK(ok.load());
+        CHECK(checksum.load() == N * (N - 1) / 2);
+        // At most ring capacity + caches are ever outstanding, far below N
+        CHECK(pool.capacity() < 8192);
+    }
+
+    TEST_CASE("ConcurrentCachelessChurn") {
+        ConcurrentPool<datapod::u64> pool(32, 8);
+        std::atomic<bool> ok{true};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                std::vector<datapod::u64 *> mine;
+                for (int round = 0; round < 2000; ++round) {
+                    for (int i = 0; i < 8; ++i) {
+                        auto *p = pool.allocate();
+                        *p = static_cast<datapod::u64>(t) << 32 | static_cast<datapod::u64>(i);
+                        mine.push_back(p);
+                    }
+                    for (int i = 0; i < 8; ++i) {
+                        if (*mine[i] != (static_cast<datapod::u64>(t) << 32 | static_cast<datapod::u64>(i))) {
+                            ok = false;
+                        }
+                        pool.deallocate(mine[i]);
+                    }
+                    mine.clear();
+                }
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        CHECK(ok.load());
+    }
+}
@@ -0,0 +1,118 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <string>
+
+using namespace datapod;
+
+// Test structs
+struct Telemetry {
+    datapod::u32 id;
+    String source;
+    Vector<double> samples;
+};
+
+static Telemetry make_telemetry() {
+    Telemetry t;
+    t.id = 11;
+    t.source = String("imu");
+    for (int i = 0; i < 1000; ++i) {
+        t.samples.push_back(i * 0.25);
+    }
+    return t;
+}
+
+TEST_CASE("hash_bulk - XXH64 reference vectors") {
+    CHECK(hash_bulk("") == 0xEF46DB3751D8E999ULL);
+    CHECK(hash_bulk("a") == 0xD24EC4F1A98C6E5BULL);
+    CHECK(hash_bulk("abc") == 0x44BC2CF5AD770999ULL);
+    CHECK(hash_bulk("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_CASE("hash_bulk - usable in constant expressions") {
+    static_assert(hash_bulk("abc") == 0x44BC2CF5AD770999ULL);
+    static_assert(hash_bulk("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1ULL);
+    static_assert(Hasher<std::string_view>{}("key") == hash_bulk(std::string_view{"key"}, BASE_HASH));
+}
+
+TEST_CASE("hash_bulk - streaming matches one-shot for every split") {
+    std::string data;
+    for (int i = 0; i < 300; ++i) {
+        data.push_back(static_cast<char>(i * 31 + 7));
+    }
+    for (datapod::usize len : {0U, 1U, 7U, 31U, 32U, 33U, 64U, 100U, 300U}) {
+        auto const expected = hash_bulk(std::string_view{data.data(), len}, 42U);
+        for (datapod::usize split = 0; split <= len; split += 5U) {
+            BulkHasher h{42U};
+            h.update(data.data(), split);
+            h.update(data.data() + split, len - split);
+            CHECK(h.digest() == expected);
+        }
+
+        BulkHasher bytewise{42U};
+        for (datapod::usize i = 0; i < len; ++i) {
+            bytewise.update(data.data() + i, 1U);
+        }
+        CHECK(bytewise.digest() == expected);
+    }
+}
+
+TEST_CASE("hash_bulk - string hashers agree across string types") {
+    String s("a string long enough to be heap allocated");
+    std::string_view sv{s.data(), s.size()};
+    CHECK(Hasher<String>{}(s) == Hasher<std::string_view>{}(sv));
+    CHECK(Hasher<char const *>{}("abc") == Hasher<std::string_view>{}("abc"));
+    CHECK(Hasher<char[4]>{}("abc") == Hasher<std::string_view>{}("abc"));
+
+    Map<String, int> m;
+    for (int i = 0; i < 200; ++i) {
+        m[String(std::to_string(i).c_str())] = i;
+    }
+    CHECK(m.size() == 200);
+    CHECK(m.at(String("123")) == 123);
+}
+
+TEST_CASE("hash_bulk - integrity checksum uses XXH64 by default") {
+    auto const t = make_telemetry();
+    auto buf = serialize<Mode::WITH_INTEGRITY>(t);
+
+    hash_t stored;
+    std::memcpy(&stored, buf.data(), sizeof(stored));
+    CHECK(stored == hash_bulk(buf.data() + sizeof(hash_t), buf.size() - sizeof(hash_t)));
+
+    auto const result = deserialize<Mode::WITH_INTEGRITY, Telemetry>(buf);
+    CHECK(result.samples.size() == 1000);
+
+    buf[buf.size() - 3] ^= 0x10;
+    CHECK_THROWS(deserialize<Mode::WITH_INTEGRITY, Telemetry>(buf));
+}
+
+TEST_CASE("hash_bulk - FNV_INTEGRITY reads and writes FNV checksums") {
+    constexpr auto FNV = Mode::WITH_INTEGRITY | Mode::FNV_INTEGRITY;
+    auto const t = make_telemetry();
+    auto buf = serialize<FNV>(t);
+
+    hash_t stored;
+    std::memcpy(&stored, buf.data(), sizeof(stored));
+    CHECK(stored == hash(std::string_view{reinterpret_cast<char const *>(buf.data()) + sizeof(hash_t),
+                                          buf.size() - sizeof(hash_t)}));
+
+    // Same body, different checksum algorithm
+    CHECK(deserialize<FNV, Telemetry>(buf).id == 11);
+    CHECK_THROWS(deserialize<Mode::WITH_INTEGRITY, Telemetry>(buf));
+    CHECK_THROWS(deserialize<FNV, Telemetry>(serialize<Mode::WITH_INTEGRITY>(t)));
+}
+
+TEST_CASE("hash_bulk - incremental integrity hasher") {
+    std::string const data(1000, 'x');
+    auto h = IntegrityHasher::for_mode<Mode::NONE>();
+    h.update(data.data(), 10U);
+    h.update(data.data() + 10U, data.size() - 10U);
+    CHECK(h.digest() == hash_bulk(data));
+
+    auto f = IntegrityHasher::for_mode<Mode::FNV_INTEGRITY>();
+    f.update(data.data(), 10U);
+    f.update(data.data() + 10U, data.size() - 10U);
+    CHECK(f.digest() == hash(std::string_view{data}));
+}
@@ -0,0 +1,284 @@
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <datapod/pods/lockfree/byte_ring.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace datapod;
+
+// A message of len bytes derived from (id, len), so the consumer can check it without a copy
+static void fill(uint8_t *p, size_t len, uint32_t id) {
+    for (size_t i = 0; i < len; i++) {
+        p[i] = static_cast<uint8_t>(id * 31 + i);
+    }
+}
+
+static bool check(const uint8_t *p, size_t len, uint32_t id) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != static_cast<uint8_t>(id * 31 + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Policy> void test_basic(const char *name) {
+    std::cout << "Test: " << name << " reserve/commit and peek/consume... ";
+
+    ByteRing<Policy> ring(256);
+    assert(ring.capacity() == 256);
+    assert(ring.max_record() == 120);
+    assert(ring.empty());
+    assert(!ring.peek());
+
+    auto res = ring.reserve(5);
+    assert(res && res.size == 5);
+    std::memcpy(res.data, "hello", 5);
+    assert(!ring.peek()); // Not visible before the commit
+    ring.commit(res);
+
+    const char msg[] = "variable length";
+    assert(ring.try_push(msg, sizeof(msg)));
+    assert(ring.try_push(nullptr, 0)); // Empty records are allowed
+    assert(ring.used() == 16 + 24 + 8);
+
+    auto rec = ring.peek();
+    assert(rec && rec.size == 5 && std::memcmp(rec.data, "hello", 5) == 0);
+    ring.consume();
+    rec = ring.peek();
+    assert(rec && rec.size == sizeof(msg) && std::memcmp(rec.data, msg, sizeof(msg)) == 0);
+    ring.consume();
+    rec = ring.peek();
+    assert(rec && rec.size == 0);
+    ring.consume();
+    assert(!ring.peek());
+    assert(ring.empty());
+
+    // Too large for any ring of this capacity
+    assert(!ring.reserve(121));
+    assert(ring.reserve(120));
+
+    std::cout << "PASSED\n";
+}
+
+template <typename Policy> void test_wrap(const char *name) {
+    std::cout << "Test: " << name << " wrap-around padding and cancel... ";
+
+    ByteRing<Policy> ring(128);
+    std::vector<uint8_t> buf(56);
+
+    // 40 + 40 + 16 bytes in use, 32 left before the end: a 40-byte payload does not fit there
+    fill(buf.data(), 32, 1);
+    assert(ring.try_push(buf.data(), 32));
+    fill(buf.data(), 32, 2);
+    assert(ring.try_push(buf.data(), 32));
+    fill(buf.data(), 8, 3);
+    assert(ring.try_push(buf.data(), 8));
+    assert(!ring.reserve(40)); // Needs the 32-byte tail plus 48 more
+    for (uint32_t id = 1; id <= 2; id++) {
+        auto rec = ring.peek();
+        assert(rec && check(rec.data, 32, id));
+        ring.consume();
+    }
+
+    // Now the record skips the tail and starts over at offset 0, contiguous
+    auto res = ring.reserve(40);
+    assert(res);
+    fill(res.data, 40, 4);
+    ring.commit(res);
+    assert(ring.used() == 16 + 32 + 48);
+
+    auto rec = ring.peek();
+    assert(rec && rec.size == 8 && check(rec.data, 8, 3));
+    ring.consume();
+    rec = ring.peek(); // The padding is skipped
+    assert(rec && rec.size == 40 && check(rec.data, 40, 4));
+    ring.consume();
+    assert(ring.empty());
+
+    // A cancelled reservation turns into padding the consumer never sees
+    res = ring.reserve(16);
+    assert(res);
+    ring.cancel(res);
+    fill(buf.data(), 8, 5);
+    assert(ring.try_push(buf.data(), 8));
+    rec = ring.peek();
+    assert(rec && rec.size == 8 && check(rec.data, 8, 5));
+    ring.consume();
+    assert(ring.empty());
+
+    // Many laps of odd sizes
+    for (uint32_t i = 0; i < 1000; i++) {
+        size_t len = (i * 7) % 57;
+        fill(buf.data(), len, i);
+        assert(ring.try_push(buf.data(), len));
+        rec = ring.peek();
+        assert(rec && rec.size == len && check(rec.data, len, i));
+        ring.consume();
+    }
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_spsc_threads() {
+    std::cout << "Test: SPSC producer/consumer threads... ";
+
+    ByteRing<SPSC> ring(4096);
+    constexpr uint32_t N = 50000;
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < N; i++) {
+            size_t len = (i * 13) % 300;
+            ByteRing<SPSC>::Reservation res;
+            while (!(res = ring.reserve(len))) {
+                std::this_thread::yield();
+            }
+            fill(res.data, len, i);
+            ring.commit(res);
+        }
+    });
+
+    bool ok = true;
+    for (uint32_t i = 0; i < N;) {
+        auto rec = ring.peek();
+        if (!rec) {
+            std::this_thread::yield();
+            continue;
+        }
+        ok = ok && rec.size == (i * 13) % 300 && check(rec.data, rec.size, i);
+        ring.consume();
+        i++;
+    }
+    producer.join();
+    assert(ok);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpsc_threads() {
+    std::cout << "Test: MPSC concurrent producers... ";
+
+    ByteRing<MPSC> ring(4096);
+    constexpr int PRODUCERS = 4;
+    constexpr uint32_t PER_PRODUCER = 10000;
+
+    // id = producer * PER_PRODUCER + i, so every record says who sent it and in which order
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&, p] {
+            for (uint32_t i = 0; i < PER_PRODUCER; i++) {
+                uint32_t id = p * PER_PRODUCER + i;
+                size_t len = 4 + (id * 13) % 200;
+                ByteRing<MPSC>::Reservation res;
+                while (!(res = ring.reserve(len))) {
+                    std::this_thread::yield();
+                }
+                std::memcpy(res.data, &id, 4);
+                fill(res.data + 4, len - 4, id);
+                ring.commit(res);
+            }
+        });
+    }
+
+    bool ok = true;
+    std::vector<uint32_t> next(PRODUCERS, 0);
+    for (uint32_t n = 0; n < PRODUCERS * PER_PRODUCER;) {
+        auto rec = ring.peek();
+        if (!rec) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t id;
+        std::memcpy(&id, rec.data, 4);
+        uint32_t p = id / PER_PRODUCER;
+        ok = ok && p < PRODUCERS && id % PER_PRODUCER == next[p] && rec.size == 4 + (id * 13) % 200 &&
+             check(rec.data + 4, rec.size - 4, id);
+        if (p < PRODUCERS) {
+            next[p]++;
+        }
+        ring.consume();
+        n++;
+    }
+    for (auto &t : producers) {
+        t.join();
+    }
+    assert(ok);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_shared_memory() {
+    std::cout << "Test: shared memory across processes... ";
+
+    String name("/test_byte_ring");
+    shm_unlink(name.c_str());
+
+    auto create_result = ByteRing<MPSC>::create_shm(name, 1024);
+    assert(create_result.is_ok());
+    auto ring = std::move(create_result.value());
+    assert(!ByteRing<SPSC>::attach_shm(name).is_ok()); // Different policy
+
+    constexpr uint32_t N = 2000;
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        auto attach_result = ByteRing<MPSC>::attach_shm(name);
+        if (!attach_result.is_ok()) {
+            _exit(2);
+        }
+        auto child = std::move(attach_result.value());
+        std::vector<uint8_t> buf(100);
+        for (uint32_t i = 0; i < N; i++) {
+            size_t len = i % 100;
+            fill(buf.data(), len, i);
+            while (!child.try_push(buf.data(), len)) {
+                std::this_thread::yield();
+            }
+        }
+        _exit(0);
+    }
+
+    bool ok = true;
+    for (uint32_t i = 0; i < N;) {
+        auto rec = ring.peek();
+        if (!rec) {
+            std::this_thread::yield();
+            continue;
+        }
+        ok = ok && rec.size == i % 100 && check(rec.data, rec.size, i);
+        ring.consume();
+        i++;
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    assert(ok);
+
+    shm_unlink(name.c_str());
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running ByteRing tests...\n\n";
+
+    test_basic<SPSC>("SPSC");
+    test_basic<MPSC>("MPSC");
+    test_wrap<SPSC>("SPSC");
+    test_wrap<MPSC>("MPSC");
+    test_spsc_threads();
+    test_mpsc_threads();
+    test_shared_memory();
+
+    std::cout << "\nAll ByteRing tests PASSED!\n";
+
+    return 0;
+}
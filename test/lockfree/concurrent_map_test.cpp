@@ -0,0 +1,250 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <datapod/pods/lockfree/concurrent_map.hpp>
+#include <datapod/pods/sequential/string.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+// Two words that must always be read together: b == ~a unless the read was torn
+struct Track {
+    uint64_t a;
+    uint64_t b;
+};
+
+void test_basic_operations() {
+    std::cout << "Test 1: Basic operations... ";
+
+    ConcurrentMap<uint64_t, uint64_t> map(5);
+    assert(map.shard_count() == 8);
+    static_assert(ConcurrentMap<uint64_t, uint64_t>::OPTIMISTIC_READS);
+    assert(map.empty());
+
+    assert(map.insert(1, 10));
+    assert(!map.insert(1, 11)); // Existing value is kept
+    assert(*map.get(1) == 10);
+    assert(!map.insert_or_assign(1, 12));
+    assert(*map.get(1) == 12);
+    assert(map.insert_or_assign(2, 20));
+    assert(map.contains(2));
+    assert(!map.contains(3));
+    assert(!map.get(3).has_value());
+
+    assert(map.update(2, [](uint64_t &v) { v += 1; }));
+    assert(!map.update(3, [](uint64_t &v) { v += 1; }));
+    assert(*map.get(2) == 21);
+    assert(map.upsert(3, [](uint64_t &v) { v += 5; }));
+    assert(!map.upsert(3, [](uint64_t &v) { v += 5; }));
+    assert(*map.get(3) == 10);
+
+    uint64_t seen = 0;
+    assert(map.visit(3, [&](const uint64_t &v) { seen = v; }));
+    assert(seen == 10);
+    assert(!map.visit(4, [&](const uint64_t &) { seen = 0; }));
+
+    assert(map.erase(1));
+    assert(!map.erase(1));
+    assert(map.size() == 2);
+
+    // Enough keys to outgrow every shard's table several times
+    for (uint64_t k = 100; k < 20100; k++) {
+        map.insert(k, k * 3);
+    }
+    assert(map.size() == 20002);
+    for (uint64_t k = 100; k < 20100; k++) {
+        assert(*map.get(k) == k * 3);
+    }
+    uint64_t sum = 0;
+    map.for_each([&](const uint64_t &, const uint64_t &v) { sum += v; });
+    assert(sum == 21 + 10 + 3 * (20099 * 20100 / 2 - 99 * 100 / 2));
+
+    map.clear();
+    assert(map.empty());
+    assert(!map.contains(150));
+    map.insert(150, 1);
+    assert(*map.get(150) == 1);
+
+    ConcurrentMap<uint64_t, uint64_t> single(1);
+    assert(single.shard_count() == 1);
+    single.insert(7, 70);
+    assert(*single.get(7) == 70);
+
+    std::cout << "PASSED\n";
+}
+
+void test_locked_reads() {
+    std::cout << "Test 2: Non-trivially-copyable values read under the shared lock... ";
+
+    ConcurrentMap<String, String> map;
+    static_assert(!ConcurrentMap<String, String>::OPTIMISTIC_READS);
+    for (int i = 0; i < 1000; i++) {
+        auto const key = String(("joint_" + std::to_string(i)).c_str());
+        assert(map.insert(key, String(std::to_string(i * i).c_str())));
+    }
+    assert(map.size() == 1000);
+    assert(*map.get(String("joint_12")) == String("144"));
+    assert(map.update(String("joint_12"), [](String &v) { v = String("changed"); }));
+    assert(*map.get(String("joint_12")) == String("changed"));
+    assert(map.erase(String("joint_999")));
+    assert(!map.contains(String("joint_999")));
+
+    std::cout << "PASSED\n";
+}
+
+void test_concurrent_readers_and_writers() {
+    std::cout << "Test 3: Optimistic readers never see torn values while tables grow... ";
+
+    constexpr int WRITERS = 2;
+    constexpr int READERS = 3;
+    constexpr uint64_t PER_WRITER = 20000;
+    ConcurrentMap<uint64_t, Track> map(4);
+    std::atomic<int> writers_done{0};
+    std::atomic<bool> torn{false};
+    std::atomic<uint64_t> hits{0};
+
+    std::vector<std::thread> threads;
+    for (int w = 0; w < WRITERS; w++) {
+        threads.emplace_back([&, w] {
+            for (uint64_t i = 0; i < PER_WRITER; i++) {
+                uint64_t const key = i * WRITERS + static_cast<uint64_t>(w);
+                map.insert_or_assign(key, Track{key, ~key});
+                // Rewrite an older key so readers also race in-place updates
+                uint64_t const old = (i / 2) * WRITERS + static_cast<uint64_t>(w);
+                map.update(old, [](Track &t) {
+                    t.a += 1;
+                    t.b = ~t.a;
+                });
+            }
+            writers_done.fetch_add(1);
+        });
+    }
+    for (int r = 0; r < READERS; r++) {
+        threads.emplace_back([&, r] {
+            uint64_t local = 0;
+            uint64_t key = static_cast<uint64_t>(r);
+            while (writers_done.load() < WRITERS) {
+                auto const t = map.get(key % (PER_WRITER * WRITERS));
+                if (t.has_value()) {
+                    if (t->b != ~t->a) {
+                        torn = true;
+                    }
+                    local++;
+                }
+                key += 7919;
+            }
+            hits.fetch_add(local);
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(!torn.load());
+    assert(map.size() == PER_WRITER * WRITERS);
+    map.for_each([](const uint64_t &, const Track &t) { assert(t.b == ~t.a); });
+
+    std::cout << "PASSED (" << hits.load() << " hits)\n";
+}
+
+void test_concurrent_counters() {
+    std::cout << "Test 4: Concurrent upserts on shared keys... ";
+
+    constexpr int THREADS = 4;
+    constexpr int ROUNDS = 20000;
+    constexpr uint64_t KEYS = 97;
+    ConcurrentMap<uint64_t, uint64_t> map(8);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < ROUNDS; i++) {
+                map.upsert(static_cast<uint64_t>(i + t) % KEYS, [](uint64_t &v) { v++; });
+                if (i % 3 == 0) {
+                    (void)map.contains(static_cast<uint64_t>(i) % KEYS);
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    uint64_t total = 0;
+    map.for_each([&](const uint64_t &, const uint64_t &v) { total += v; });
+    assert(total == static_cast<uint64_t>(THREADS) * ROUNDS);
+    assert(map.size() == KEYS);
+
+    std::cout << "PASSED\n";
+}
+
+// A writer pauses halfway through a change. A reader that slips in must not accept the half-written
+// value: it either retries into the lock (and waits for the writer) or reads a consistent copy.
+static void check_read_during_write(ConcurrentMap<uint64_t, Track> &map, uint64_t key) {
+    std::atomic<bool> mid_write{false};
+    std::atomic<bool> read_done{false};
+    std::thread writer([&] {
+        map.update(key, [&](Track &t) {
+            t.a += 1;
+            mid_write = true;
+            auto const deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+            while (!read_done.load() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            t.b = ~t.a;
+        });
+    });
+    while (!mid_write.load()) {
+        std::this_thread::yield();
+    }
+    auto const t = map.get(key);
+    read_done = true;
+    writer.join();
+    assert(t.has_value());
+    assert(t->b == ~t->a);
+}
+
+void test_throwing_callbacks() {
+    std::cout << "Test 5: A throwing update leaves optimistic reads consistent... ";
+
+    ConcurrentMap<uint64_t, Track> map(1);
+    map.insert(1, Track{1, ~uint64_t{1}});
+
+    bool threw = false;
+    try {
+        map.update(1, [](Track &) { throw std::runtime_error("update"); });
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    check_read_during_write(map, 1);
+
+    threw = false;
+    try {
+        map.upsert(2, [](Track &) { throw std::runtime_error("upsert"); });
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    check_read_during_write(map, 1);
+    assert(map.get(1)->a == 3);
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running ConcurrentMap tests...\n\n";
+
+    test_basic_operations();
+    test_locked_reads();
+    test_concurrent_readers_and_writers();
+    test_concurrent_counters();
+    test_throwing_callbacks();
+
+    std::cout << "\nAll ConcurrentMap tests PASSED!\n";
+
+    return 0;
+}
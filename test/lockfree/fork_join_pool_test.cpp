@@ -0,0 +1,119 @@
+#include <atomic>
+#include <cassert>
+#include <datapod/pods/lockfree/fork_join_pool.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+static uint64_t fib(ForkJoinPool &pool, int n) {
+    if (n < 2) {
+        return static_cast<uint64_t>(n);
+    }
+    uint64_t a = 0;
+    uint64_t b = 0;
+    pool.invoke([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+void test_invoke() {
+    std::cout << "Test 1: Recursive invoke... ";
+
+    ForkJoinPool pool(4);
+    assert(pool.threads() == 4);
+    assert(fib(pool, 22) == 17711);
+
+    // A single-slot pool runs everything on the caller
+    ForkJoinPool serial(1);
+    assert(fib(serial, 15) == 610);
+
+    std::cout << "PASSED\n";
+}
+
+void test_parallel_for() {
+    std::cout << "Test 2: parallel for runs every index exactly once... ";
+
+    ForkJoinPool pool(4);
+    constexpr size_t N = 100000;
+    std::vector<std::atomic<int>> hits(N);
+    std::atomic<uint64_t> sum{0};
+    pool(N, [&](size_t i) {
+        hits[i].fetch_add(1);
+        sum.fetch_add(i);
+    });
+    for (size_t i = 0; i < N; i++) {
+        assert(hits[i].load() == 1);
+    }
+    assert(sum.load() == N * (N - 1) / 2);
+
+    pool(0, [](size_t) { assert(false); });
+    size_t single = 7;
+    pool(1, [&](size_t i) { single = i; });
+    assert(single == 0);
+
+    std::cout << "PASSED\n";
+}
+
+void test_exceptions() {
+    std::cout << "Test 3: Exceptions from either side reach the caller... ";
+
+    ForkJoinPool pool(3);
+    bool caught = false;
+    try {
+        pool.invoke([] {}, [] { throw std::runtime_error("forked"); });
+    } catch (const std::runtime_error &e) {
+        caught = std::string(e.what()) == "forked";
+    }
+    assert(caught);
+
+    caught = false;
+    std::atomic<bool> other_ran{false};
+    try {
+        pool.invoke([] { throw std::runtime_error("inline"); }, [&] { other_ran = true; });
+    } catch (const std::runtime_error &e) {
+        caught = std::string(e.what()) == "inline";
+    }
+    assert(caught);
+    assert(other_ran.load()); // The forked side still finished before invoke() returned
+
+    // The pool is still usable afterwards
+    assert(fib(pool, 12) == 144);
+
+    std::cout << "PASSED\n";
+}
+
+void test_external_callers() {
+    std::cout << "Test 4: Several outside threads share the pool... ";
+
+    ForkJoinPool pool(3);
+    std::atomic<int> ok{0};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; t++) {
+        callers.emplace_back([&] {
+            if (fib(pool, 16) == 987) {
+                ok.fetch_add(1);
+            }
+        });
+    }
+    for (auto &t : callers) {
+        t.join();
+    }
+    assert(ok.load() == 4);
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running ForkJoinPool tests...\n\n";
+
+    test_invoke();
+    test_parallel_for();
+    test_exceptions();
+    test_external_callers();
+
+    std::cout << "\nAll ForkJoinPool tests PASSED!\n";
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <datapod/pods/lockfree/ring_buffer.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace datapod;
+
+struct Frame {
+    uint64_t seq;
+    uint64_t payload[31]; // Every word equals seq, so a torn copy is detectable
+};
+
+static Frame make_frame(uint64_t seq) {
+    Frame f;
+    f.seq = seq;
+    for (auto &w : f.payload) {
+        w = seq;
+    }
+    return f;
+}
+
+static bool intact(const Frame &f) {
+    for (auto w : f.payload) {
+        if (w != f.seq) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_broadcast_basic() {
+    std::cout << "Test 1: Broadcast every reader sees every item... ";
+
+    RingBuffer<Broadcast, int> ring(8);
+    assert(ring.capacity() == 8);
+
+    auto a = ring.reader();
+    auto b = ring.reader();
+    assert(!a.try_pop().has_value());
+    assert(!a.pop().is_ok());
+
+    for (int i = 0; i < 5; i++) {
+        assert(ring.push(i).is_ok());
+    }
+    assert(ring.published() == 5);
+    assert(a.available() == 5);
+
+    for (int i = 0; i < 5; i++) {
+        assert(a.pop().value() == i);
+    }
+    for (int i = 0; i < 5; i++) {
+        assert(b.pop().value() == i);
+    }
+    assert(!a.try_pop().has_value());
+    assert(!b.try_pop().has_value());
+
+    // A reader created later starts with the next item
+    auto late = ring.reader();
+    assert(ring.push(5).is_ok());
+    assert(late.pop().value() == 5);
+    assert(a.pop().value() == 5);
+    assert(a.lost() == 0);
+
+    std::cout << "PASSED\n";
+}
+
+void test_broadcast_overrun() {
+    std::cout << "Test 2: Broadcast overrun detection... ";
+
+    RingBuffer<Broadcast, int> ring(4);
+    auto slow = ring.reader();
+    auto fast = ring.reader();
+
+    // The writer never blocks; the slow reader skips to the oldest item still held
+    for (int i = 0; i < 10; i++) {
+        assert(ring.push(i).is_ok());
+        assert(fast.pop().value() == i);
+    }
+    assert(slow.available() == 10);
+    assert(slow.pop().value() == 6);
+    assert(slow.lost() == 6);
+    assert(slow.pop().value() == 7);
+    assert(fast.lost() == 0);
+
+    // Capacity is rounded up to a power of two
+    RingBuffer<Broadcast, int> odd(5);
+    assert(odd.capacity() == 8);
+
+    std::cout << "PASSED\n";
+}
+
+void test_broadcast_zero_copy() {
+    std::cout << "Test 3: Broadcast zero-copy write and read... ";
+
+    RingBuffer<Broadcast, Frame> ring(2);
+    auto reader = ring.reader();
+
+    Frame *slot = ring.reserve_write();
+    *slot = make_frame(1);
+    assert(reader.peek() == nullptr); // Not visible before the commit
+    ring.commit_write();
+
+    const Frame *f = reader.peek();
+    assert(f != nullptr);
+    assert(f->seq == 1 && intact(*f));
+    assert(reader.consume());
+
+    // Lapped while looking at the slot: consume() reports it
+    std::vector<Frame> batch{make_frame(2), make_frame(3)};
+    assert(ring.push_n(std::span<const Frame>(batch)) == 2);
+    f = reader.peek();
+    assert(f->seq == 2);
+    assert(ring.push(make_frame(4)).is_ok()); // Reuses the slot of frame 2
+    assert(!reader.consume());
+    assert(reader.lost() == 1);
+    assert(reader.pop().value().seq == 3);
+    assert(reader.pop().value().seq == 4);
+
+    std::cout << "PASSED\n";
+}
+
+void test_broadcast_threads() {
+    std::cout << "Test 4: Broadcast concurrent readers, no torn reads... ";
+
+    using namespace std::chrono_literals;
+    RingOptions options;
+    options.blocking = true;
+    RingBuffer<Broadcast, Frame> ring(64, options);
+    constexpr uint64_t N = 20000;
+    constexpr int READERS = 3;
+
+    std::atomic<int> ready{0};
+    std::atomic<bool> ok{true};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; r++) {
+        readers.emplace_back([&] {
+            auto reader = ring.reader();
+            ready.fetch_add(1);
+            uint64_t last = 0;
+            uint64_t seen = 0;
+            while (last < N) {
+                auto f = reader.pop_wait(5s);
+                if (!f.is_ok()) {
+                    ok = false;
+                    return;
+                }
+                // Items arrive in order; gaps only where lost() says so
+                if (!intact(f.value()) || f.value().seq <= last) {
+                    ok = false;
+                }
+                last = f.value().seq;
+                seen++;
+            }
+            if (seen + reader.lost() != N) {
+                ok = false;
+            }
+        });
+    }
+    while (ready.load() < READERS) {
+        std::this_thread::yield();
+    }
+
+    for (uint64_t i = 1; i <= N; i++) {
+        assert(ring.push(make_frame(i)).is_ok());
+    }
+    for (auto &t : readers) {
+        t.join();
+    }
+    assert(ok.load());
+
+    std::cout << "PASSED\n";
+}
+
+void test_broadcast_shared_memory() {
+    std::cout << "Test 5: Broadcast shared memory across processes... ";
+
+    using namespace std::chrono_literals;
+    String name("/test_broadcast_ring");
+    shm_unlink(name.c_str());
+
+    RingOptions options;
+    options.blocking = true; // Attached readers follow the creator's header
+    auto create_result = RingBuffer<Broadcast, Frame>::create_shm(name, 1024, options);
+    assert(create_result.is_ok());
+    auto ring = std::move(create_result.value());
+    assert((!RingBuffer<SPSC, Frame>::attach_shm(name).is_ok())); // Different policy
+
+    // Every subscriber process sees every frame; the ring is large enough that nobody is lapped
+    constexpr int SUBSCRIBERS = 2;
+    constexpr uint64_t N = 1000;
+    int pipes[SUBSCRIBERS][2];
+    pid_t pids[SUBSCRIBERS];
+    for (int s = 0; s < SUBSCRIBERS; s++) {
+        assert(pipe(pipes[s]) == 0);
+        pids[s] = fork();
+        assert(pids[s] >= 0);
+        if (pids[s] == 0) {
+            auto attach_result = RingBuffer<Broadcast, Frame>::attach_shm(name);
+            if (!attach_result.is_ok()) {
+                _exit(2);
+            }
+            auto sub = std::move(attach_result.value());
+            auto reader = sub.reader();
+            char go = 1;
+            if (write(pipes[s][1], &go, 1) != 1) {
+                _exit(3);
+            }
+            for (uint64_t i = 1; i <= N; i++) {
+                auto f = reader.pop_wait(5s);
+                if (!f.is_ok() || f.value().seq != i || !intact(f.value())) {
+                    _exit(1);
+                }
+            }
+            _exit(reader.lost() == 0 ? 0 : 4);
+        }
+        char go = 0;
+        assert(read(pipes[s][0], &go, 1) == 1);
+        close(pipes[s][0]);
+        close(pipes[s][1]);
+    }
+
+    for (uint64_t i = 1; i <= N; i++) {
+        assert(ring.push(make_frame(i)).is_ok());
+    }
+
+    for (int s = 0; s < SUBSCRIBERS; s++) {
+        int status = 0;
+        waitpid(pids[s], &status, 0);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    shm_unlink(name.c_str());
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running Broadcast RingBuffer tests...\n\n";
+
+    test_broadcast_basic();
+    test_broadcast_overrun();
+    test_broadcast_zero_copy();
+    test_broadcast_threads();
+    test_broadcast_shared_memory();
+
+    std::cout << "\nAll Broadcast tests PASSED!\n";
+
+    return 0;
+}
@@ -373,6 +373,285 @@ void test_mpmc_stress() {
     std::cout << "PASSED (took " << duration.count() << "ms)\n";
 }
 
+void test_mpmc_power_of_two_capacity() {
+    std::cout << "Test 14: MPMC Power-of-two capacity... ";
+
+    RingBuffer<MPMC, int> ring(100);
+    assert(ring.capacity() == 128);
+
+    for (int i = 0; i < 128; i++) {
+        assert(ring.push(i).is_ok());
+    }
+    assert(ring.full());
+    assert(!ring.push(128).is_ok());
+
+    // Several laps around the ring
+    for (int i = 0; i < 1000; i++) {
+        auto val = ring.pop();
+        assert(val.is_ok());
+        assert(val.value() == i);
+        assert(ring.push(i + 128).is_ok());
+    }
+    assert(ring.size() == 128);
+
+    RingBuffer<MPMC, int> small(0);
+    assert(small.capacity() == 2);
+    assert(small.push(7).is_ok());
+    assert(small.push(8).is_ok());
+    assert(!small.push(9).is_ok());
+    assert(small.pop().value() == 7);
+    assert(small.pop().value() == 8);
+    assert(!small.pop().is_ok());
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpmc_no_torn_reads() {
+    std::cout << "Test 15: MPMC No torn or early reads... ";
+
+    // Wide items written field by field: a consumer that read a slot before its producer
+    // finished writing it would see mismatched fields
+    struct Item {
+        uint64_t producer;
+        uint64_t seq;
+        uint64_t check[6];
+    };
+
+    RingBuffer<MPMC, Item> ring(64);
+    const int NUM_PRODUCERS = 4;
+    const int NUM_CONSUMERS = 4;
+    const uint64_t ITEMS_PER_PRODUCER = 50000;
+
+    std::atomic<bool> ok{true};
+    std::atomic<uint64_t> total_popped{0};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < NUM_PRODUCERS; p++) {
+        producers.emplace_back([&ring, p, ITEMS_PER_PRODUCER]() {
+            for (uint64_t i = 0; i < ITEMS_PER_PRODUCER; i++) {
+                Item item{static_cast<uint64_t>(p), i, {}};
+                for (auto &c : item.check) {
+                    c = item.producer * 1000003u + i;
+                }
+                while (!ring.push(item).is_ok()) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < NUM_CONSUMERS; c++) {
+        consumers.emplace_back([&]() {
+            // Items of one producer reach any single consumer in the order they were pushed
+            std::vector<int64_t> last(NUM_PRODUCERS, -1);
+            while (total_popped.load(std::memory_order_relaxed) < NUM_PRODUCERS * ITEMS_PER_PRODUCER) {
+                auto result = ring.pop();
+                if (!result.is_ok()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto const &item = result.value();
+                for (auto c : item.check) {
+                    if (c != item.producer * 1000003u + item.seq) {
+                        ok.store(false);
+                    }
+                }
+                if (item.producer >= NUM_PRODUCERS || static_cast<int64_t>(item.seq) <= last[item.producer]) {
+                    ok.store(false);
+                } else {
+                    last[item.producer] = static_cast<int64_t>(item.seq);
+                }
+                total_popped.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (auto &t : producers) {
+        t.join();
+    }
+    for (auto &t : consumers) {
+        t.join();
+    }
+
+    assert(ok.load());
+    assert(total_popped.load() == NUM_PRODUCERS * ITEMS_PER_PRODUCER);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpmc_batches() {
+    std::cout << "Test 16: MPMC Batch push_n/pop_n... ";
+
+    RingBuffer<MPMC, int> ring(8);
+    std::vector<int> in(20);
+    std::vector<int> out(20);
+    for (int i = 0; i < 20; i++) {
+        in[i] = i;
+    }
+
+    assert(ring.push_n(std::span<const int>(in)) == 8);
+    assert(ring.full());
+    assert(ring.push_n(std::span<const int>(in.data(), 1)) == 0);
+    assert(ring.pop_n(std::span<int>(out.data(), 5)) == 5);
+    assert(out[4] == 4);
+
+    // Wraps around the end of the slots
+    assert(ring.push_n(std::span<const int>(in.data() + 8, 12)) == 5);
+    assert(ring.pop_n(std::span<int>(out)) == 8);
+    for (int i = 0; i < 8; i++) {
+        assert(out[i] == i + 5);
+    }
+    assert(ring.empty());
+    assert(ring.pop_n(std::span<int>(out)) == 0);
+    assert(ring.pop_n(std::span<int>()) == 0);
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpmc_shared_memory_batches() {
+    std::cout << "Test 17: MPMC Shared-memory batches, producers and consumers... ";
+
+    shm_unlink("/test_mpmc_batches");
+    auto create_result = RingBuffer<MPMC, uint64_t>::create_shm("/test_mpmc_batches", 128);
+    assert(create_result.is_ok());
+
+    constexpr int THREADS = 3;
+    constexpr uint64_t PER_PRODUCER = 30000;
+    constexpr uint64_t N = PER_PRODUCER * THREADS;
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> sum{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < THREADS; p++) {
+        threads.emplace_back([&, p] {
+            auto attach_result = RingBuffer<MPMC, uint64_t>::attach_shm("/test_mpmc_batches");
+            assert(attach_result.is_ok());
+            auto &ring = attach_result.value();
+            std::vector<uint64_t> batch(17);
+            for (uint64_t next = 0; next < PER_PRODUCER;) {
+                size_t n = 0;
+                for (; n < batch.size() && next + n < PER_PRODUCER; n++) {
+                    batch[n] = static_cast<uint64_t>(p) * PER_PRODUCER + next + n;
+                }
+                size_t pushed = ring.push_n(std::span<const uint64_t>(batch.data(), n));
+                next += pushed;
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < THREADS; c++) {
+        threads.emplace_back([&] {
+            auto attach_result = RingBuffer<MPMC, uint64_t>::attach_shm("/test_mpmc_batches");
+            assert(attach_result.is_ok());
+            auto &ring = attach_result.value();
+            std::vector<uint64_t> out(23);
+            uint64_t local = 0;
+            while (popped.load() < N) {
+                size_t n = ring.pop_n(std::span<uint64_t>(out));
+                for (size_t i = 0; i < n; i++) {
+                    local += out[i];
+                }
+                popped.fetch_add(n);
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            sum.fetch_add(local);
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(popped.load() == N);
+    assert(sum.load() == N * (N - 1) / 2);
+    shm_unlink("/test_mpmc_batches");
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpmc_try_push_pop() {
+    std::cout << "Test 18: MPMC try_push/try_pop... ";
+
+    RingBuffer<MPMC, int> ring(4);
+    assert(!ring.try_pop().has_value());
+    for (int i = 0; i < 4; i++) {
+        assert(ring.try_push(i));
+    }
+    int five = 5;
+    assert(!ring.try_push(five));
+    assert(!ring.try_push(6));
+    for (int i = 0; i < 4; i++) {
+        auto val = ring.try_pop();
+        assert(val.has_value());
+        assert(*val == i);
+    }
+    assert(!ring.try_pop().has_value());
+
+    // The Result-returning calls report the same outcomes
+    assert(ring.push(7).is_ok());
+    assert(ring.pop().value() == 7);
+    assert(ring.pop().error().code == Error::TIMEOUT);
+
+    std::cout << "PASSED\n";
+}
+
+void test_mpmc_blocking_wait() {
+    std::cout << "Test 19: MPMC Blocking push_wait/pop_wait with several waiters... ";
+
+    using namespace std::chrono_literals;
+    RingBuffer<MPMC, uint64_t> plain(4);
+    assert(plain.pop_wait(0ms).error().code == Error::INVALID_ARGUMENT); // Not created blocking
+
+    RingOptions options;
+    options.blocking = true;
+    RingBuffer<MPMC, uint64_t> ring(4, options);
+    assert(ring.pop_wait(10ms).error().code == Error::TIMEOUT);
+
+    // Consumers sleep in pop_wait; every item reaches exactly one of them
+    constexpr int CONSUMERS = 3;
+    constexpr uint64_t N = 3000;
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> popped{0};
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; c++) {
+        consumers.emplace_back([&] {
+            while (true) {
+                auto val = ring.pop_wait(5s);
+                assert(val.is_ok());
+                if (val.value() == N) {
+                    return; // One stop marker per consumer
+                }
+                sum.fetch_add(val.value());
+                popped.fetch_add(1);
+            }
+        });
+    }
+
+    for (uint64_t i = 0; i < N; i++) {
+        assert(ring.push_wait(i, 5s).is_ok());
+        if (i % 500 == 0) {
+            std::this_thread::sleep_for(1ms); // Let the consumers fall asleep
+        }
+    }
+    for (int c = 0; c < CONSUMERS; c++) {
+        assert(ring.push_wait(N, 5s).is_ok());
+    }
+    for (auto &t : consumers) {
+        t.join();
+    }
+
+    assert(popped.load() == N);
+    assert(sum.load() == N * (N - 1) / 2);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
 int main() {
     std::cout << "Running MPMC RingBuffer tests...\n\n";
 
@@ -389,6 +668,12 @@ int main() {
     test_mpmc_drain();
     test_mpmc_shared_memory();
     test_mpmc_stress();
+    test_mpmc_power_of_two_capacity();
+    test_mpmc_no_torn_reads();
+    test_mpmc_batches();
+    test_mpmc_shared_memory_batches();
+    test_mpmc_try_push_pop();
+    test_mpmc_blocking_wait();
 
     std::cout << "\nAll MPMC tests PASSED!\n";
 
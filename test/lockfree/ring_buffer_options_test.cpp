@@ -0,0 +1,109 @@
+#include <cassert>
+#include <cstring>
+#include <datapod/pods/lockfree/byte_ring.hpp>
+#include <datapod/pods/lockfree/ring_buffer.hpp>
+#include <iostream>
+
+using namespace datapod;
+
+template <typename Policy> void round_trip(const RingOptions &options) {
+    RingBuffer<Policy, uint64_t> ring(1000, options);
+    for (uint64_t i = 0; i < 3000; i++) {
+        assert(ring.push(i).is_ok());
+        assert(ring.pop().value() == i);
+    }
+}
+
+void test_memory_helpers() {
+    std::cout << "Test 1: ring_memory allocate/release... ";
+
+    // Default options keep the aligned_alloc path
+    size_t mapped = 1;
+    void *mem = ring_memory::allocate(100, RingOptions{}, mapped);
+    assert(mem != nullptr && mapped == 0);
+    assert(reinterpret_cast<uintptr_t>(mem) % 64 == 0);
+    ring_memory::release(mem, mapped);
+
+    // Any option maps the memory; huge pages fall back to normal pages when none are reserved
+    RingOptions huge;
+    huge.huge_pages = true;
+    huge.populate = true;
+    mem = ring_memory::allocate(100000, huge, mapped);
+    assert(mem != nullptr && mapped >= 100000);
+    std::memset(mem, 0xAB, 100000);
+    ring_memory::release(mem, mapped);
+
+    assert(ring_memory::huge_page_size() >= 4096);
+
+    std::cout << "PASSED\n";
+}
+
+void test_policies_with_options() {
+    std::cout << "Test 2: every policy with huge pages, populate and NUMA... ";
+
+    RingOptions options;
+    options.huge_pages = true;
+    options.populate = true;
+    options.numa_node = 0;
+    round_trip<SPSC>(options);
+    round_trip<SPMC>(options);
+    round_trip<MPMC>(options);
+
+    RingBuffer<Broadcast, uint64_t> broadcast(1000, options);
+    auto reader = broadcast.reader();
+    assert(broadcast.push(7).is_ok());
+    assert(reader.pop().value() == 7);
+
+    ByteRing<MPSC> bytes(4096, options);
+    assert(bytes.try_push("abc", 3));
+    assert(bytes.peek().size == 3);
+
+    // A node that does not exist is only a hint: the ring still works
+    RingOptions far;
+    far.numa_node = 1000;
+    round_trip<SPSC>(far);
+
+    std::cout << "PASSED\n";
+}
+
+void test_shm_with_options() {
+    std::cout << "Test 3: shared memory with populate and huge pages... ";
+
+    String name("/test_ring_options");
+    shm_unlink(name.c_str());
+
+    RingOptions options;
+    options.huge_pages = true;
+    options.populate = true;
+    options.numa_node = 0;
+    auto create_result = RingBuffer<SPSC, uint64_t>::create_shm(name, 4096, options);
+    assert(create_result.is_ok());
+    auto producer = std::move(create_result.value());
+
+    RingOptions attach_options;
+    attach_options.populate = true;
+    auto attach_result = RingBuffer<SPSC, uint64_t>::attach_shm(name, attach_options);
+    assert(attach_result.is_ok());
+    auto consumer = std::move(attach_result.value());
+
+    for (uint64_t i = 0; i < 10000; i++) {
+        assert(producer.push(i).is_ok());
+        assert(consumer.pop().value() == i);
+    }
+
+    shm_unlink(name.c_str());
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running RingOptions tests...\n\n";
+
+    test_memory_helpers();
+    test_policies_with_options();
+    test_shm_with_options();
+
+    std::cout << "\nAll RingOptions tests PASSED!\n";
+
+    return 0;
+}
@@ -1,7 +1,12 @@
 #include <cassert>
+#include <chrono>
 #include <datapod/pods/lockfree/ring_buffer.hpp>
 #include <datapod/pods/sequential/string.hpp>
 #include <iostream>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace datapod;
 
@@ -132,6 +137,53 @@ void test_shm_multiple_moves() {
     std::cout << "PASSED\n";
 }
 
+void test_shm_wait_across_processes() {
+    std::cout << "Test 5: SHM pop_wait/push_wait across processes... ";
+
+    using namespace std::chrono_literals;
+    String name("/test_shm_wait");
+    shm_unlink(name.c_str());
+
+    RingOptions options;
+    options.blocking = true; // Recorded in the header, so the attached child can wait too
+    auto create_result = RingBuffer<SPSC, uint32_t>::create_shm(name, 8, options);
+    assert(create_result.is_ok());
+    auto ring = std::move(create_result.value());
+
+    // The child blocks in pop_wait on the shared header; the parent keeps it starved at first
+    constexpr uint32_t N = 5000;
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        auto attach_result = RingBuffer<SPSC, uint32_t>::attach_shm(name);
+        if (!attach_result.is_ok()) {
+            _exit(2);
+        }
+        auto reader = std::move(attach_result.value());
+        for (uint32_t i = 0; i < N; i++) {
+            auto val = reader.pop_wait(5s);
+            if (!val.is_ok() || val.value() != i) {
+                _exit(1);
+            }
+        }
+        _exit(0);
+    }
+
+    std::this_thread::sleep_for(50ms);
+    for (uint32_t i = 0; i < N; i++) {
+        assert(ring.push_wait(i, 5s).is_ok());
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    assert(ring.empty());
+
+    shm_unlink(name.c_str());
+
+    std::cout << "PASSED\n";
+}
+
 int main() {
     std::cout << "Running RingBuffer SHM tests...\n\n";
 
@@ -139,6 +191,7 @@ int main() {
     test_shm_move_semantics();
     test_shm_ownership_transfer();
     test_shm_multiple_moves();
+    test_shm_wait_across_processes();
 
     std::cout << "\nAll SHM tests PASSED!\n";
     std::cout << "The move semantics bug has been fixed!\n";
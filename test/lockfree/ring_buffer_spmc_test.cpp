@@ -1,4 +1,6 @@
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <datapod/pods/lockfree/ring_buffer.hpp>
 #include <iostream>
 #include <thread>
@@ -339,6 +341,182 @@ void test_spmc_peek() {
     std::cout << "PASSED\n";
 }
 
+void test_spmc_batches() {
+    std::cout << "Test 14: SPMC Batches and zero-copy access... ";
+
+    RingBuffer<SPMC, int> ring(10);
+    std::vector<int> in(20);
+    std::vector<int> out(20);
+    for (int i = 0; i < 20; i++) {
+        in[i] = i;
+    }
+
+    assert(ring.push_n(std::span<const int>(in)) == 10);
+    assert(ring.pop_n(std::span<int>(out.data(), 6)) == 6);
+    assert(out[5] == 5);
+
+    // The write position is back at slot 0, so the free slots 0..5 are one span
+    auto region = ring.reserve_write(8);
+    assert(region.size() == 6);
+    assert(region.second.empty());
+    for (auto &v : region.first) {
+        v = 100;
+    }
+    ring.commit_write(6);
+    assert(ring.full());
+
+    // A view claims nothing until consumed, and a stale view can no longer be consumed
+    auto view = ring.read_view();
+    assert(view.size() == 10);
+    assert(view.first.size() == 4);
+    assert(view.first[0] == 6);
+    assert(view.second[5] == 100);
+    auto stale = ring.read_view();
+    assert(ring.consume(view, 4));
+    assert(!ring.consume(stale, 1));
+    assert(ring.pop_n(std::span<int>(out)) == 6);
+    assert(out[0] == 100);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_spmc_shared_memory_batches() {
+    std::cout << "Test 15: SPMC Shared-memory batches, multiple consumers... ";
+
+    shm_unlink("/test_spmc_batches");
+    auto create_result = RingBuffer<SPMC, uint64_t>::create_shm("/test_spmc_batches", 256);
+    assert(create_result.is_ok());
+    auto &writer = create_result.value();
+
+    constexpr uint64_t N = 100000;
+    constexpr int CONSUMERS = 3;
+    std::atomic<uint64_t> popped{0};
+    std::atomic<uint64_t> sum{0};
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; c++) {
+        consumers.emplace_back([&] {
+            auto attach_result = RingBuffer<SPMC, uint64_t>::attach_shm("/test_spmc_batches");
+            assert(attach_result.is_ok());
+            auto &reader = attach_result.value();
+            std::vector<uint64_t> out(32);
+            uint64_t local = 0;
+            while (popped.load() < N) {
+                size_t n = reader.pop_n(std::span<uint64_t>(out));
+                for (size_t i = 0; i < n; i++) {
+                    local += out[i];
+                }
+                popped.fetch_add(n);
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            sum.fetch_add(local);
+        });
+    }
+
+    std::vector<uint64_t> batch(50);
+    for (uint64_t next = 0; next < N;) {
+        size_t n = 0;
+        for (; n < batch.size() && next + n < N; n++) {
+            batch[n] = next + n;
+        }
+        size_t pushed = writer.push_n(std::span<const uint64_t>(batch.data(), n));
+        next += pushed;
+        if (pushed == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &t : consumers) {
+        t.join();
+    }
+
+    assert(popped.load() == N);
+    assert(sum.load() == N * (N - 1) / 2);
+    shm_unlink("/test_spmc_batches");
+
+    std::cout << "PASSED\n";
+}
+
+void test_spmc_try_push_pop() {
+    std::cout << "Test 16: SPMC try_push/try_pop... ";
+
+    RingBuffer<SPMC, int> ring(4);
+    assert(!ring.try_pop().has_value());
+    for (int i = 0; i < 4; i++) {
+        assert(ring.try_push(i));
+    }
+    int five = 5;
+    assert(!ring.try_push(five));
+    assert(!ring.try_push(6));
+    for (int i = 0; i < 4; i++) {
+        auto val = ring.try_pop();
+        assert(val.has_value());
+        assert(*val == i);
+    }
+    assert(!ring.try_pop().has_value());
+
+    // The Result-returning calls report the same outcomes
+    assert(ring.push(7).is_ok());
+    assert(ring.pop().value() == 7);
+    assert(ring.pop().error().code == Error::TIMEOUT);
+
+    std::cout << "PASSED\n";
+}
+
+void test_spmc_blocking_wait() {
+    std::cout << "Test 17: SPMC Blocking push_wait/pop_wait with several waiters... ";
+
+    using namespace std::chrono_literals;
+    RingBuffer<SPMC, uint64_t> plain(4);
+    assert(plain.pop_wait(0ms).error().code == Error::INVALID_ARGUMENT); // Not created blocking
+
+    RingOptions options;
+    options.blocking = true;
+    RingBuffer<SPMC, uint64_t> ring(4, options);
+    assert(ring.pop_wait(10ms).error().code == Error::TIMEOUT);
+
+    // Consumers sleep in pop_wait; every item reaches exactly one of them
+    constexpr int CONSUMERS = 3;
+    constexpr uint64_t N = 3000;
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> popped{0};
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; c++) {
+        consumers.emplace_back([&] {
+            while (true) {
+                auto val = ring.pop_wait(5s);
+                assert(val.is_ok());
+                if (val.value() == N) {
+                    return; // One stop marker per consumer
+                }
+                sum.fetch_add(val.value());
+                popped.fetch_add(1);
+            }
+        });
+    }
+
+    for (uint64_t i = 0; i < N; i++) {
+        assert(ring.push_wait(i, 5s).is_ok());
+        if (i % 500 == 0) {
+            std::this_thread::sleep_for(1ms); // Let the consumers fall asleep
+        }
+    }
+    for (int c = 0; c < CONSUMERS; c++) {
+        assert(ring.push_wait(N, 5s).is_ok());
+    }
+    for (auto &t : consumers) {
+        t.join();
+    }
+
+    assert(popped.load() == N);
+    assert(sum.load() == N * (N - 1) / 2);
+    assert(ring.empty());
+
+    std::cout << "PASSED\n";
+}
+
 int main() {
     std::cout << "Running SPMC RingBuffer tests...\n\n";
 
@@ -355,6 +533,10 @@ int main() {
     test_spmc_shared_memory();
     test_spmc_stress();
     test_spmc_peek();
+    test_spmc_batches();
+    test_spmc_shared_memory_batches();
+    test_spmc_try_push_pop();
+    test_spmc_blocking_wait();
 
     std::cout << "\nAll SPMC tests PASSED!\n";
 
@@ -1,6 +1,9 @@
 #include <datapod/pods/lockfree/ring_buffer.hpp>
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 using namespace datapod;
 
@@ -183,6 +186,298 @@ void test_drain() {
     std::cout << "PASSED\n";
 }
 
+void test_non_power_of_two() {
+    std::cout << "Test 10: Non-power-of-two capacity... ";
+    
+    // Modulo indexing for odd capacities, masking for powers of two; both over many laps
+    for (size_t capacity : {1, 3, 5, 8, 100}) {
+        RingBuffer<SPSC, int> ring(capacity);
+        int next_push = 0;
+        int next_pop = 0;
+        for (int round = 0; round < 50; round++) {
+            while (ring.push(next_push).is_ok()) {
+                next_push++;
+            }
+            assert(ring.full());
+            assert(ring.size() == capacity);
+            for (size_t i = 0; i < capacity / 2 + 1; i++) {
+                auto val = ring.pop();
+                assert(val.is_ok());
+                assert(val.value() == next_pop++);
+            }
+        }
+        while (ring.pop().is_ok()) {
+        }
+        assert(ring.empty());
+    }
+    
+    std::cout << "PASSED\n";
+}
+
+void test_threaded_order() {
+    std::cout << "Test 11: Producer/consumer threads keep FIFO order... ";
+    
+    RingBuffer<SPSC, uint64_t> ring(64);
+    const uint64_t N = 500000;
+    
+    std::thread producer([&ring, N]() {
+        for (uint64_t i = 0; i < N; i++) {
+            while (!ring.push(i).is_ok()) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    bool ok = true;
+    for (uint64_t expected = 0; expected < N;) {
+        auto val = ring.pop();
+        if (!val.is_ok()) {
+            std::this_thread::yield();
+            continue;
+        }
+        ok = ok && val.value() == expected;
+        expected++;
+    }
+    producer.join();
+    
+    assert(ok);
+    assert(ring.empty());
+    
+    std::cout << "PASSED\n";
+}
+
+void test_batches() {
+    std::cout << "Test 12: Batch push_n/pop_n... ";
+    
+    RingBuffer<SPSC, int> ring(10);
+    std::vector<int> in(25);
+    std::vector<int> out(25);
+    for (int i = 0; i < 25; i++) {
+        in[i] = i;
+    }
+    
+    // Partial batches when the ring fills up or runs empty
+    assert(ring.push_n(std::span<const int>(in.data(), 25)) == 10);
+    assert(ring.full());
+    assert(ring.push_n(std::span<const int>(in.data(), 1)) == 0);
+    assert(ring.pop_n(std::span<int>(out.data(), 7)) == 7);
+    for (int i = 0; i < 7; i++) {
+        assert(out[i] == i);
+    }
+    
+    // Wraps around the end of the buffer on both sides
+    assert(ring.push_n(std::span<const int>(in.data() + 10, 15)) == 7);
+    assert(ring.size() == 10);
+    assert(ring.pop_n(std::span<int>(out.data(), 25)) == 10);
+    for (int i = 0; i < 10; i++) {
+        assert(out[i] == i + 7);
+    }
+    assert(ring.empty());
+    assert(ring.pop_n(std::span<int>(out.data(), 25)) == 0);
+    assert(ring.push_n(std::span<const int>()) == 0);
+    
+    std::cout << "PASSED\n";
+}
+
+void test_zero_copy() {
+    std::cout << "Test 13: Zero-copy reserve_write/read_view... ";
+    
+    RingBuffer<SPSC, int> ring(8);
+    for (int i = 0; i < 6; i++) {
+        assert(ring.push(i).is_ok());
+    }
+    for (int i = 0; i < 6; i++) {
+        assert(ring.pop().is_ok());
+    }
+    
+    // Two free spans: slots 6..7, then 0..3
+    auto region = ring.reserve_write(6);
+    assert(region.size() == 6);
+    assert(region.first.size() == 2);
+    assert(region.second.size() == 4);
+    for (size_t i = 0; i < region.first.size(); i++) {
+        region.first[i] = 100 + static_cast<int>(i);
+    }
+    for (size_t i = 0; i < region.second.size(); i++) {
+        region.second[i] = 102 + static_cast<int>(i);
+    }
+    assert(ring.empty()); // Not visible before the commit
+    ring.commit_write(5);
+    assert(ring.size() == 5);
+    assert(ring.reserve_write(100).size() == 3);
+    
+    auto view = ring.read_view();
+    assert(view.size() == 5);
+    assert(view.first.size() == 2);
+    assert(view.first[0] == 100);
+    assert(view.second[2] == 104);
+    ring.consume(3);
+    assert(ring.size() == 2);
+    assert(ring.pop().value() == 103);
+    ring.consume(ring.read_view().size());
+    assert(ring.empty());
+    assert(ring.read_view().empty());
+    
+    std::cout << "PASSED\n";
+}
+
+void test_shm_batches() {
+    std::cout << "Test 14: Shared-memory batches across threads... ";
+    
+    shm_unlink("/test_spsc_batches");
+    auto create_result = RingBuffer<SPSC, uint64_t>::create_shm("/test_spsc_batches", 1000);
+    assert(create_result.is_ok());
+    auto attach_result = RingBuffer<SPSC, uint64_t>::attach_shm("/test_spsc_batches");
+    assert(attach_result.is_ok());
+    auto &writer = create_result.value();
+    auto &reader = attach_result.value();
+    
+    constexpr uint64_t N = 200000;
+    std::thread producer([&] {
+        std::vector<uint64_t> batch(97);
+        uint64_t next = 0;
+        while (next < N) {
+            // Alternate copying batches and filling reserved slots in place
+            if ((next / 97) % 2 == 0) {
+                size_t n = 0;
+                for (; n < batch.size() && next + n < N; n++) {
+                    batch[n] = next + n;
+                }
+                next += writer.push_n(std::span<const uint64_t>(batch.data(), n));
+            } else {
+                auto region = writer.reserve_write(N - next < 97 ? N - next : 97);
+                for (auto &v : region.first) {
+                    v = next++;
+                }
+                for (auto &v : region.second) {
+                    v = next++;
+                }
+                writer.commit_write(region.size());
+            }
+        }
+    });
+    
+    bool ok = true;
+    uint64_t expected = 0;
+    std::vector<uint64_t> out(64);
+    while (expected < N) {
+        size_t n = 0;
+        if (expected % 2 == 0) {
+            n = reader.pop_n(std::span<uint64_t>(out));
+            for (size_t i = 0; i < n; i++) {
+                ok = ok && out[i] == expected + i;
+            }
+        } else {
+            auto view = reader.read_view();
+            n = view.size();
+            for (size_t i = 0; i < view.first.size(); i++) {
+                ok = ok && view.first[i] == expected + i;
+            }
+            for (size_t i = 0; i < view.second.size(); i++) {
+                ok = ok && view.second[i] == expected + view.first.size() + i;
+            }
+            reader.consume(n);
+        }
+        expected += n;
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    
+    assert(ok);
+    assert(reader.empty());
+    shm_unlink("/test_spsc_batches");
+    
+    std::cout << "PASSED\n";
+}
+
+void test_try_push_pop() {
+    std::cout << "Test 15: try_push/try_pop... ";
+    
+    RingBuffer<SPSC, int> ring(4);
+    assert(!ring.try_pop().has_value());
+    for (int i = 0; i < 4; i++) {
+        assert(ring.try_push(i));
+    }
+    int five = 5;
+    assert(!ring.try_push(five));
+    assert(!ring.try_push(6));
+    for (int i = 0; i < 4; i++) {
+        auto val = ring.try_pop();
+        assert(val.has_value());
+        assert(*val == i);
+    }
+    assert(!ring.try_pop().has_value());
+    
+    // The Result-returning calls report the same outcomes
+    assert(ring.push(7).is_ok());
+    assert(ring.pop().value() == 7);
+    assert(ring.pop().error().code == Error::TIMEOUT);
+    
+    std::cout << "PASSED\n";
+}
+
+void test_blocking_wait() {
+    std::cout << "Test 16: Blocking push_wait/pop_wait... ";
+    
+    using namespace std::chrono_literals;
+    RingBuffer<SPSC, int> plain(2);
+    assert(plain.pop_wait(0ms).error().code == Error::INVALID_ARGUMENT); // Not created blocking
+    assert(plain.push_wait(1, 0ms).error().code == Error::INVALID_ARGUMENT);
+
+    RingOptions options;
+    options.blocking = true;
+    RingBuffer<SPSC, int> ring(2, options);
+    
+    // Times out on an empty ring, returns at once when an item is there
+    auto start = std::chrono::steady_clock::now();
+    auto miss = ring.pop_wait(20ms);
+    assert(!miss.is_ok());
+    assert(miss.error().code == Error::TIMEOUT);
+    assert(std::chrono::steady_clock::now() - start >= 20ms);
+    assert(ring.push(1).is_ok());
+    assert(ring.pop_wait(0ms).value() == 1);
+    
+    // A sleeping consumer is woken by the producer
+    std::thread producer([&] {
+        std::this_thread::sleep_for(20ms);
+        assert(ring.push(2).is_ok());
+    });
+    assert(ring.pop_wait(5s).value() == 2);
+    producer.join();
+    
+    // A sleeping producer is woken when the consumer frees a slot
+    assert(ring.push(3).is_ok());
+    assert(ring.push(4).is_ok());
+    assert(!ring.push_wait(5, 10ms).is_ok());
+    std::thread consumer([&] {
+        std::this_thread::sleep_for(20ms);
+        assert(ring.pop().value() == 3);
+    });
+    assert(ring.push_wait(5, 5s).is_ok());
+    consumer.join();
+    assert(ring.pop().value() == 4);
+    assert(ring.pop().value() == 5);
+    
+    // Streams through a small ring with both sides blocking
+    constexpr int N = 20000;
+    std::thread writer([&] {
+        for (int i = 0; i < N; i++) {
+            assert(ring.push_wait(i, 5s).is_ok());
+        }
+    });
+    bool ok = true;
+    for (int i = 0; i < N; i++) {
+        auto val = ring.pop_wait(5s);
+        ok = ok && val.is_ok() && val.value() == i;
+    }
+    writer.join();
+    assert(ok);
+    
+    std::cout << "PASSED\n";
+}
+
 int main() {
     std::cout << "Running RingBuffer tests...\n\n";
     
@@ -195,6 +490,13 @@ int main() {
     test_snapshot_with_data();
     test_from_snapshot();
     test_drain();
+    test_non_power_of_two();
+    test_threaded_order();
+    test_batches();
+    test_zero_copy();
+    test_shm_batches();
+    test_try_push_pop();
+    test_blocking_wait();
     
     std::cout << "\nAll tests PASSED!\n";
     
@@ -0,0 +1,122 @@
+#include <atomic>
+#include <cassert>
+#include <datapod/pods/lockfree/work_stealing_deque.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace datapod;
+
+void test_owner_lifo_thief_fifo() {
+    std::cout << "Test 1: Owner pops LIFO, thieves steal FIFO... ";
+
+    WorkStealingDeque<int> dq(4);
+    assert(dq.empty());
+    assert(!dq.pop().has_value());
+    assert(!dq.steal().has_value());
+
+    for (int i = 0; i < 5; i++) {
+        dq.push(i);
+    }
+    assert(dq.size() == 5);
+    assert(dq.steal().value() == 0);
+    assert(dq.steal().value() == 1);
+    assert(dq.pop().value() == 4);
+    assert(dq.pop().value() == 3);
+    assert(dq.pop().value() == 2);
+    assert(!dq.pop().has_value());
+    assert(dq.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_growth() {
+    std::cout << "Test 2: Buffer grows and keeps order across wrap-around... ";
+
+    WorkStealingDeque<uint64_t> dq(2);
+    assert(dq.capacity() == 2);
+
+    // Move the indices away from zero so the copy on growth wraps
+    for (uint64_t i = 0; i < 7; i++) {
+        dq.push(i);
+        assert(dq.steal().value() == i);
+    }
+    for (uint64_t i = 0; i < 1000; i++) {
+        dq.push(i);
+    }
+    assert(dq.capacity() >= 1000);
+    assert(dq.size() == 1000);
+    for (uint64_t i = 0; i < 500; i++) {
+        assert(dq.steal().value() == i);
+    }
+    for (uint64_t i = 1000; i-- > 500;) {
+        assert(dq.pop().value() == i);
+    }
+    assert(dq.empty());
+
+    std::cout << "PASSED\n";
+}
+
+void test_concurrent_steal() {
+    std::cout << "Test 3: Concurrent owner and thieves take every item once... ";
+
+    constexpr uint64_t N = 200000;
+    constexpr int THIEVES = 3;
+    WorkStealingDeque<uint64_t> dq(16); // Small, so it grows while thieves are reading
+
+    std::vector<std::atomic<uint8_t>> taken(N);
+    std::atomic<uint64_t> count{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < THIEVES; t++) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !dq.empty()) {
+                if (auto v = dq.steal()) {
+                    taken[*v].fetch_add(1);
+                    count.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // The owner interleaves pushes with pops, like a worker forking and joining
+    for (uint64_t i = 0; i < N; i++) {
+        dq.push(i);
+        if (i % 3 == 0) {
+            if (auto v = dq.pop()) {
+                taken[*v].fetch_add(1);
+                count.fetch_add(1);
+            }
+        }
+    }
+    while (auto v = dq.pop()) {
+        taken[*v].fetch_add(1);
+        count.fetch_add(1);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto &t : thieves) {
+        t.join();
+    }
+
+    assert(count.load() == N);
+    for (uint64_t i = 0; i < N; i++) {
+        assert(taken[i].load() == 1);
+    }
+
+    std::cout << "PASSED\n";
+}
+
+int main() {
+    std::cout << "Running WorkStealingDeque tests...\n\n";
+
+    test_owner_lifo_thief_fifo();
+    test_growth();
+    test_concurrent_steal();
+
+    std::cout << "\nAll WorkStealingDeque tests PASSED!\n";
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <cstring>
+
+using namespace datapod;
+
+// Test structs
+struct FlatSample {
+    double t;
+    float x;
+    float y;
+};
+
+struct PaddedSample {
+    datapod::u8 flag;
+    datapod::u32 value;
+};
+
+struct TailPaddedSample {
+    datapod::u32 value;
+    datapod::u8 flag;
+};
+
+struct ReorderedSample {
+    datapod::u32 a;
+    datapod::u32 b;
+
+    auto members() noexcept { return std::tie(b, a); }
+};
+
+struct NestedFlat {
+    FlatSample sample;
+    double extra[2];
+
+    auto members() noexcept { return std::tie(sample, extra); }
+};
+
+TEST_CASE("serialize bulk - flat layout detection") {
+    CHECK(is_flat_v<int>);
+    CHECK(is_flat_v<double>);
+    CHECK(is_flat_v<Point>);
+    CHECK(is_flat_v<FlatSample>);
+    CHECK(is_flat_v<NestedFlat>);
+    CHECK(is_flat_v<Array<float, 4>>);
+    CHECK(is_flat_v<double[3]>);
+
+    CHECK_FALSE(is_flat_v<PaddedSample>);
+    CHECK_FALSE(is_flat_v<TailPaddedSample>);
+    CHECK_FALSE(is_flat_v<String>);
+    CHECK_FALSE(is_flat_v<Vector<int>>);
+    CHECK_FALSE(is_flat_v<Array<int, 0>>);
+
+    CHECK(is_bulk_copyable_v<Mode::NONE, Point>);
+    CHECK(is_bulk_copyable_v<Mode::WITH_VERSION, Point>);
+}
+
+TEST_CASE("serialize bulk - vector of flat structs is a raw copy") {
+    Vector<Point> points;
+    for (int i = 0; i < 1000; ++i) {
+        points.push_back(Point{i * 1.0, i * 2.0, i * 3.0});
+    }
+
+    auto buf = serialize(points);
+    REQUIRE(buf.size() == sizeof(datapod::usize) + points.size() * sizeof(Point));
+    CHECK(std::memcmp(buf.data() + sizeof(datapod::usize), points.data(), points.size() * sizeof(Point)) == 0);
+
+    auto result = deserialize<Mode::NONE, Vector<Point>>(buf);
+    REQUIRE(result.size() == points.size());
+    CHECK(result[0] == points[0]);
+    CHECK(result[999] == points[999]);
+}
+
+TEST_CASE("serialize bulk - output matches the per-element encoding") {
+    Vector<FlatSample> samples;
+    for (int i = 0; i < 16; ++i) {
+        samples.push_back(FlatSample{i * 0.5, static_cast<float>(i), static_cast<float>(-i)});
+    }
+
+    auto bulk = serialize(samples);
+
+    // Per-element reference encoding through the reflection path
+    auto b = Buf{};
+    auto ctx = SerializationContext<Buf<ByteBuf>, Mode::NONE>{b};
+    auto sz = samples.size();
+    serialize<Mode::NONE>(ctx, sz);
+    for (auto &s : samples) {
+        serialize<Mode::NONE>(ctx, s);
+    }
+
+    CHECK(bulk == b.buf_);
+}
+
+TEST_CASE("serialize bulk - reordered members() falls back to field order") {
+    Vector<ReorderedSample> v;
+    v.push_back(ReorderedSample{1, 2});
+    v.push_back(ReorderedSample{3, 4});
+
+    auto buf = serialize(v);
+    datapod::u32 first = 0;
+    std::memcpy(&first, buf.data() + sizeof(datapod::usize), sizeof(first));
+    CHECK(first == 2);
+
+    auto result = deserialize<Mode::NONE, Vector<ReorderedSample>>(buf);
+    REQUIRE(result.size() == 2);
+    CHECK(result[0].a == 1);
+    CHECK(result[0].b == 2);
+    CHECK(result[1].a == 3);
+    CHECK(result[1].b == 4);
+}
+
+TEST_CASE("serialize bulk - padded structs still round-trip") {
+    Vector<PaddedSample> v;
+    v.push_back(PaddedSample{1, 100});
+    v.push_back(PaddedSample{2, 200});
+
+    auto result = deserialize<Mode::NONE, Vector<PaddedSample>>(serialize(v));
+    REQUIRE(result.size() == 2);
+    CHECK(result[1].flag == 2);
+    CHECK(result[1].value == 200);
+}
+
+TEST_CASE("serialize bulk - big endian takes the per-element path") {
+    Vector<Point> points;
+    points.push_back(Point{1.0, 2.0, 3.0});
+    points.push_back(Point{4.0, 5.0, 6.0});
+
+    auto buf = serialize<Mode::SERIALIZE_BIG_ENDIAN>(points);
+    auto result = deserialize<Mode::SERIALIZE_BIG_ENDIAN, Vector<Point>>(buf);
+    REQUIRE(result.size() == 2);
+    CHECK(result[1] == points[1]);
+}
+
+TEST_CASE("serialize bulk - fixed-size arrays") {
+    struct Holder {
+        Array<double, 4> arr;
+        float raw[3];
+        NestedFlat nested;
+
+        auto members() noexcept { return std::tie(arr, raw, nested); }
+    };
+
+    Holder h{{1.0, 2.0, 3.0, 4.0}, {5.0f, 6.0f, 7.0f}, {{8.0, 9.0f, 10.0f}, {11.0, 12.0}}};
+    auto result = deserialize<Mode::NONE, Holder>(serialize(h));
+    CHECK(result.arr[3] == 4.0);
+    CHECK(result.raw[2] == 7.0f);
+    CHECK(result.nested.sample.y == 10.0f);
+    CHECK(result.nested.extra[1] == 12.0);
+}
+
+TEST_CASE("serialize bulk - mat types and grid data") {
+    mat::Vector<double, 3> v{1.0, 2.0, 3.0};
+    auto rv = deserialize<Mode::NONE, mat::Vector<double, 3>>(serialize(v));
+    CHECK(rv[2] == 3.0);
+
+    mat::Matrix<float, 2, 2> m;
+    m(0, 0) = 1.0f;
+    m(1, 1) = 4.0f;
+    auto rm = deserialize<Mode::NONE, mat::Matrix<float, 2, 2>>(serialize(m));
+    CHECK(rm(0, 0) == 1.0f);
+    CHECK(rm(1, 1) == 4.0f);
+
+    Grid<float> g;
+    g.rows = 64;
+    g.cols = 64;
+    g.resolution = 0.1;
+    g.data.resize(g.rows * g.cols);
+    for (datapod::usize i = 0; i < g.data.size(); ++i) {
+        g.data[i] = static_cast<float>(i);
+    }
+    auto rg = deserialize<Mode::NONE, Grid<float>>(serialize(g));
+    REQUIRE(rg.data.size() == g.data.size());
+    CHECK(rg(63, 63) == g(63, 63));
+    CHECK(rg == g);
+}
+
+TEST_CASE("serialize bulk - empty containers") {
+    Vector<Point> empty;
+    auto buf = serialize(empty);
+    CHECK(buf.size() == sizeof(datapod::usize));
+    CHECK(deserialize<Mode::NONE, Vector<Point>>(buf).empty());
+}
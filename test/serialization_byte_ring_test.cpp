@@ -0,0 +1,146 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+#include "datapod/serialization/byte_ring.hpp"
+
+#include <thread>
+
+using namespace datapod;
+
+// Test structs
+struct Scan {
+    datapod::u32 seq;
+    String frame;
+    Vector<float> ranges;
+};
+
+static Scan make_scan(datapod::u32 seq) {
+    Scan s;
+    s.seq = seq;
+    s.frame = String("lidar");
+    s.ranges.resize(seq % 40);
+    for (datapod::usize i = 0; i < s.ranges.size(); ++i) {
+        s.ranges[i] = static_cast<float>(seq) + static_cast<float>(i) * 0.25f;
+    }
+    return s;
+}
+
+static bool same(Scan const &a, Scan const &b) {
+    if (a.seq != b.seq || a.frame != b.frame || a.ranges.size() != b.ranges.size()) {
+        return false;
+    }
+    for (datapod::usize i = 0; i < a.ranges.size(); ++i) {
+        if (a.ranges[i] != b.ranges[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("RegionBuf - encodes the same bytes as serialize()") {
+    auto s = make_scan(17);
+    auto const expected = serialize(s);
+
+    std::vector<datapod::u8> region(serialized_size_of(s));
+    auto target = RegionBuf{region.data(), region.size()};
+    serialize_to(target, s);
+    CHECK(target.size() == expected.size());
+    CHECK(std::equal(expected.begin(), expected.end(), region.begin()));
+}
+
+TEST_CASE("RegionBuf - integrity checksum matches Buf") {
+    constexpr auto M = Mode::WITH_INTEGRITY;
+    auto s = make_scan(33);
+    auto const expected = serialize<M>(s);
+
+    std::vector<datapod::u8> region(serialized_size_of<M>(s));
+    auto target = RegionBuf{region.data(), region.size()};
+    serialize_to<M>(target, s);
+    CHECK(std::equal(expected.begin(), expected.end(), region.begin()));
+    CHECK(same(deserialize<M, Scan>(region.data(), region.size()), s));
+}
+
+TEST_CASE("RegionBuf - writing past the region throws") {
+    auto s = make_scan(39);
+    std::vector<datapod::u8> region(serialized_size_of(s) - 1U);
+    auto target = RegionBuf{region.data(), region.size()};
+    CHECK_THROWS(serialize_to(target, s));
+}
+
+TEST_CASE("serialize_to_ring - round trip through SPSC and MPSC rings") {
+    ByteRing<SPSC> spsc(4096);
+    ByteRing<MPSC> mpsc(4096);
+    for (datapod::u32 i = 0; i < 10; ++i) {
+        auto s = make_scan(i);
+        CHECK(serialize_to_ring(spsc, s));
+        CHECK(serialize_to_ring<Mode::WITH_VERSION>(mpsc, s));
+    }
+    for (datapod::u32 i = 0; i < 10; ++i) {
+        auto a = deserialize_from_ring<Mode::NONE, Scan>(spsc);
+        auto b = deserialize_from_ring<Mode::WITH_VERSION, Scan>(mpsc);
+        REQUIRE(a.has_value());
+        REQUIRE(b.has_value());
+        CHECK(same(*a, make_scan(i)));
+        CHECK(same(*b, make_scan(i)));
+    }
+    CHECK(!deserialize_from_ring<Mode::NONE, Scan>(spsc).has_value());
+    CHECK(spsc.empty());
+}
+
+TEST_CASE("serialize_to_ring - full ring and oversized messages") {
+    ByteRing<SPSC> ring(256);
+    auto s = make_scan(20);
+    REQUIRE(serialized_size_of(s) <= ring.max_record());
+    auto n = 0;
+    while (serialize_to_ring(ring, s)) {
+        ++n;
+    }
+    CHECK(n == 2);
+    CHECK(deserialize_from_ring<Mode::NONE, Scan>(ring).has_value());
+    CHECK(serialize_to_ring(ring, s)); // Room again once a record is consumed
+
+    auto big = make_scan(39);
+    big.ranges.resize(100);
+    CHECK_THROWS(serialize_to_ring(ring, big));
+}
+
+TEST_CASE("deserialize_from_ring - a bad record is consumed") {
+    constexpr auto M = Mode::WITH_VERSION;
+    ByteRing<SPSC> ring(1024);
+    datapod::u32 junk = 7;
+    CHECK(serialize_to_ring(ring, junk)); // Written without a version hash
+    auto s = make_scan(5);
+    CHECK(serialize_to_ring<M>(ring, s));
+
+    CHECK_THROWS(deserialize_from_ring<M, Scan>(ring));
+    auto next = deserialize_from_ring<M, Scan>(ring);
+    REQUIRE(next.has_value());
+    CHECK(same(*next, s));
+}
+
+TEST_CASE("serialize_to_ring - producer and consumer threads") {
+    ByteRing<MPSC> ring(8192);
+    constexpr datapod::u32 N = 5000;
+
+    std::thread producer([&] {
+        for (datapod::u32 i = 0; i < N; ++i) {
+            auto s = make_scan(i);
+            while (!serialize_to_ring(ring, s)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool ok = true;
+    for (datapod::u32 i = 0; i < N;) {
+        auto s = deserialize_from_ring<Mode::NONE, Scan>(ring);
+        if (!s.has_value()) {
+            std::this_thread::yield();
+            continue;
+        }
+        ok = ok && same(*s, make_scan(i));
+        ++i;
+    }
+    producer.join();
+    CHECK(ok);
+}
@@ -0,0 +1,188 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <cstring>
+#include <string>
+
+using namespace datapod;
+
+// Test structs
+struct Scan {
+    datapod::u32 id;
+    String frame;
+    Vector<float> ranges;
+    Vector<String> notes;
+};
+
+static Scan make_scan(datapod::usize n) {
+    Scan s;
+    s.id = 9;
+    s.frame = String("laser");
+    s.ranges.resize(n);
+    for (datapod::usize i = 0; i < n; ++i) {
+        s.ranges[i] = static_cast<float>(i);
+    }
+    s.notes.push_back(String("a"));
+    s.notes.push_back(String("b"));
+    return s;
+}
+
+static hash_t stored_checksum(ByteBuf const &buf) {
+    hash_t stored;
+    std::memcpy(&stored, buf.data(), sizeof(stored));
+    return stored;
+}
+
+// Position of the ranges length prefix (the first usize equal to n)
+static datapod::usize find_length(ByteBuf const &buf, datapod::usize n) {
+    for (datapod::usize pos = 0; pos + sizeof(n) <= buf.size(); pos += alignof(datapod::usize)) {
+        if (std::memcmp(buf.data() + pos, &n, sizeof(n)) == 0) {
+            return pos;
+        }
+    }
+    return buf.size();
+}
+
+static std::string error_of(auto &&fn) {
+    try {
+        fn();
+    } catch (std::exception const &e) {
+        return e.what();
+    }
+    return {};
+}
+
+TEST_CASE("checksum - running hash in Buf matches a full pass") {
+    for (datapod::usize n : {0U, 3U, 5000U, 100000U}) {
+        auto s = make_scan(n);
+        auto const buf = serialize<Mode::WITH_INTEGRITY>(s);
+        CHECK(stored_checksum(buf) ==
+              integrity_checksum<Mode::NONE>(buf.data() + sizeof(hash_t), buf.size() - sizeof(hash_t)));
+
+        constexpr auto FNV = Mode::WITH_INTEGRITY | Mode::FNV_INTEGRITY;
+        auto const fnv = serialize<FNV>(s);
+        CHECK(stored_checksum(fnv) ==
+              integrity_checksum<FNV>(fnv.data() + sizeof(hash_t), fnv.size() - sizeof(hash_t)));
+    }
+}
+
+TEST_CASE("checksum - patched or mismatched ranges fall back to a full pass") {
+    auto b = Buf{};
+    b.begin_checksum<Mode::NONE>(0U);
+    datapod::u64 v = 1;
+    for (int i = 0; i < 5000; ++i) {
+        b.write(&v, sizeof(v), alignof(datapod::u64));
+    }
+    b.write(8U, datapod::u64{42}); // Patch bytes that were already hashed
+
+    CHECK(b.checksum<Mode::NONE>(0U) == integrity_checksum<Mode::NONE>(b.buf_.data(), b.size()));
+    CHECK(b.checksum<Mode::NONE>(16U) == integrity_checksum<Mode::NONE>(b.buf_.data() + 16, b.size() - 16U));
+    CHECK(b.checksum<Mode::FNV_INTEGRITY>(0U) ==
+          integrity_checksum<Mode::FNV_INTEGRITY>(b.buf_.data(), b.size()));
+}
+
+TEST_CASE("checksum - truncate rolls back the running hash") {
+    datapod::u64 v = 1;
+    datapod::u64 w = 2;
+
+    // Dropped bytes were still pending: the running hash goes on
+    auto pending = Buf{};
+    pending.begin_checksum<Mode::NONE>(0U);
+    pending.write(&v, sizeof(v), alignof(datapod::u64));
+    pending.truncate(0U);
+    pending.write(&w, sizeof(w), alignof(datapod::u64));
+    CHECK(pending.checksum<Mode::NONE>(0U) == integrity_checksum<Mode::NONE>(&w, sizeof(w)));
+
+    // Dropped bytes were already hashed
+    auto hashed = Buf{};
+    hashed.begin_checksum<Mode::NONE>(0U);
+    for (int i = 0; i < 5000; ++i) {
+        hashed.write(&v, sizeof(v), alignof(datapod::u64));
+    }
+    hashed.truncate(64U);
+    hashed.write(&w, 1U);
+    CHECK(hashed.size() == 65U);
+    CHECK(hashed[72] == 0U); // Dropped bytes are zeroed
+    CHECK(hashed.checksum<Mode::NONE>(0U) ==
+          integrity_checksum<Mode::NONE>(hashed.buf_.data(), hashed.size()));
+}
+
+TEST_CASE("checksum - running hash in DeserializationContext") {
+    auto scan = make_scan(20000);
+    auto const buf = serialize(scan);
+    auto ctx = DeserializationContext<Mode::NONE>(buf.data(), buf.size());
+    ctx.begin_checksum();
+
+    Scan s;
+    deserialize<Mode::NONE>(ctx, s);
+    CHECK(s.ranges.size() == 20000);
+    CHECK(ctx.checksum() == integrity_checksum<Mode::NONE>(buf.data(), buf.size()));
+}
+
+TEST_CASE("checksum - single pass decode reports corruption as integrity failure") {
+    auto s = make_scan(1000);
+    auto buf = serialize<Mode::WITH_INTEGRITY | Mode::WITH_VERSION>(s);
+    CHECK(deserialize<Mode::WITH_INTEGRITY | Mode::WITH_VERSION, Scan>(buf).ranges.size() == 1000);
+
+    // Blow up the ranges length prefix: decoding fails before the end of the buffer
+    auto bad_length = buf;
+    auto const ranges_size_pos = find_length(buf, 1000U);
+    REQUIRE(ranges_size_pos < buf.size());
+    bad_length[ranges_size_pos + 6U] = 0x7F;
+    auto const error = error_of([&] { (void)deserialize<Mode::WITH_INTEGRITY | Mode::WITH_VERSION, Scan>(bad_length); });
+    CHECK(error.find("integrity") != std::string::npos);
+
+    // Corrupting the version hash is an integrity failure too
+    auto bad_version = buf;
+    bad_version[sizeof(hash_t)] ^= 0x01;
+    CHECK(error_of([&] { (void)deserialize<Mode::WITH_INTEGRITY | Mode::WITH_VERSION, Scan>(bad_version); })
+              .find("integrity") != std::string::npos);
+
+    // Without integrity the bogus length is still rejected before allocating
+    auto plain = serialize(s);
+    auto const plain_size_pos = find_length(plain, 1000U);
+    REQUIRE(plain_size_pos < plain.size());
+    plain[plain_size_pos + 6U] = 0x7F;
+    CHECK(error_of([&] { (void)deserialize<Mode::NONE, Scan>(plain); }).find("length") != std::string::npos);
+}
+
+TEST_CASE("checksum - block checksums locate corruption") {
+    auto s = make_scan(300000);
+    auto buf = serialize(s);
+    auto const table = block_checksums(buf, 64U * 1024U);
+    CHECK(table.sums.size() == (buf.size() + 64U * 1024U - 1U) / (64U * 1024U));
+    CHECK(corrupted_blocks(buf, table).empty());
+
+    buf[3U * 64U * 1024U + 17U] ^= 0x10;
+    buf[buf.size() - 1U] ^= 0x10;
+    auto const bad = corrupted_blocks(buf, table);
+    REQUIRE(bad.size() == 2U);
+    CHECK(bad[0] == 3U);
+    CHECK(bad[1] == table.sums.size() - 1U);
+
+    // Parallel and sequential hashing agree
+    auto const sequential = block_checksums(buf.data(), buf.size(), 64U * 1024U, ThreadExecutor{1});
+    auto const parallel = block_checksums(buf.data(), buf.size(), 64U * 1024U, ThreadExecutor{4});
+    CHECK(sequential.sums == parallel.sums);
+}
+
+TEST_CASE("checksum - truncated or extended buffers") {
+    auto scan = make_scan(100000);
+    auto buf = serialize(scan);
+    auto const table = block_checksums(buf, 4096U);
+
+    auto truncated = buf;
+    truncated.resize(buf.size() - 10U);
+    auto const missing = corrupted_blocks(truncated, table);
+    REQUIRE(missing.size() == 1U);
+    CHECK(missing[0] == table.sums.size() - 1U);
+
+    auto extended = buf;
+    extended.resize(buf.size() + 5000U);
+    CHECK(corrupted_blocks(extended, table).size() >= 1U);
+
+    // The table itself serializes like any aggregate
+    auto copy = table;
+    CHECK(deserialize<Mode::NONE, BlockChecksums>(serialize(copy)).sums == table.sums);
+}
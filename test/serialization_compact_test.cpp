@@ -0,0 +1,223 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <cstring>
+#include <limits>
+#include <unistd.h>
+
+using namespace datapod;
+
+// Test structs
+enum class Status : datapod::u16 { IDLE = 0, ACTIVE = 1, FAULT = 500 };
+
+struct Telemetry {
+    datapod::u32 id;
+    datapod::i64 offset;
+    Status status;
+    bool armed;
+    double voltage;
+    String label;
+    Vector<datapod::i32> deltas;
+    Vector<float> samples;
+    Optional<datapod::u16> channel;
+    Map<datapod::u32, String> names;
+    Variant<datapod::i32, String> note;
+};
+
+struct Small {
+    datapod::u32 id;
+    datapod::i16 x;
+    float f;
+    String s;
+};
+
+struct Cell {
+    datapod::i32 x;
+    datapod::i32 y;
+};
+
+static Telemetry make_telemetry() {
+    Telemetry t;
+    t.id = 42;
+    t.offset = -7;
+    t.status = Status::FAULT;
+    t.armed = true;
+    t.voltage = 12.5;
+    t.label = String("radio");
+    for (datapod::i32 i = -5; i < 5; ++i) {
+        t.deltas.push_back(i * 3);
+    }
+    t.samples.resize(100);
+    for (datapod::usize i = 0; i < t.samples.size(); ++i) {
+        t.samples[i] = static_cast<float>(i) * 0.25f;
+    }
+    t.channel = datapod::u16{3};
+    t.names.insert({1U, String("left")});
+    t.names.insert({70000U, String("right")});
+    t.note = String("ok");
+    return t;
+}
+
+static void check_telemetry(Telemetry const &t) {
+    CHECK(t.id == 42);
+    CHECK(t.offset == -7);
+    CHECK(t.status == Status::FAULT);
+    CHECK(t.armed);
+    CHECK(t.voltage == 12.5);
+    CHECK(t.label == String("radio"));
+    REQUIRE(t.deltas.size() == 10);
+    CHECK(t.deltas[0] == -15);
+    CHECK(t.deltas[9] == 12);
+    REQUIRE(t.samples.size() == 100);
+    CHECK(t.samples[99] == 24.75f);
+    REQUIRE(t.channel.has_value());
+    CHECK(*t.channel == 3);
+    CHECK(t.names.size() == 2);
+    CHECK(t.names.at(70000U) == String("right"));
+    CHECK(t.note.index() == 1);
+}
+
+TEST_CASE("compact - varint and zigzag primitives") {
+    datapod::u8 bytes[VARINT_MAX_BYTES];
+    for (datapod::u64 v : {0ULL, 1ULL, 127ULL, 128ULL, 300ULL, 16383ULL, 16384ULL, 0xFFFFFFFFULL,
+                           std::numeric_limits<datapod::u64>::max()}) {
+        auto const n = varint_encode(v, bytes);
+        CHECK(n == varint_size(v));
+        datapod::u64 out = 0;
+        CHECK(varint_decode(bytes, bytes + n, out) == n);
+        CHECK(out == v);
+        CHECK(varint_decode(bytes, bytes + n - 1, out) == 0U); // Truncated
+    }
+    CHECK(varint_size(std::numeric_limits<datapod::u64>::max()) == VARINT_MAX_BYTES);
+
+    // Eleven continuation bytes, or a tenth byte carrying bits past 64
+    datapod::u8 overlong[11];
+    std::memset(overlong, 0x80, sizeof(overlong));
+    datapod::u64 out = 0;
+    CHECK(varint_decode(overlong, overlong + sizeof(overlong), out) == 0U);
+    overlong[9] = 0x02;
+    CHECK(varint_decode(overlong, overlong + 10, out) == 0U);
+
+    // Non-canonical: padded with zero groups that the encoder never writes
+    datapod::u8 const padded_zero[] = {0x80, 0x00};
+    CHECK(varint_decode(padded_zero, padded_zero + 2, out) == 0U);
+    datapod::u8 const padded_one[] = {0x81, 0x80, 0x00};
+    CHECK(varint_decode(padded_one, padded_one + 3, out) == 0U);
+    datapod::u8 const single_zero[] = {0x00};
+    CHECK(varint_decode(single_zero, single_zero + 1, out) == 1U);
+    CHECK(out == 0U);
+
+    CHECK(zigzag_encode(datapod::i32{0}) == 0U);
+    CHECK(zigzag_encode(datapod::i32{-1}) == 1U);
+    CHECK(zigzag_encode(datapod::i32{1}) == 2U);
+    CHECK(zigzag_encode(datapod::i32{-2}) == 3U);
+    for (datapod::i64 v : {datapod::i64{0}, datapod::i64{-1}, datapod::i64{63}, datapod::i64{-64},
+                           std::numeric_limits<datapod::i64>::min(), std::numeric_limits<datapod::i64>::max()}) {
+        CHECK(zigzag_decode<datapod::i64>(zigzag_encode(v)) == v);
+    }
+    CHECK(zigzag_decode<datapod::i16>(zigzag_encode(std::numeric_limits<datapod::i16>::min())) ==
+          std::numeric_limits<datapod::i16>::min());
+}
+
+TEST_CASE("compact - exact encoding") {
+    Small s{300, -2, 1.5f, String("hi")};
+    auto const buf = serialize<Mode::COMPACT>(s);
+
+    float f = 1.5f;
+    datapod::u8 expected[9] = {0xAC, 0x02, 0x03, 0, 0, 0, 0, 0x02, 'h'};
+    std::memcpy(expected + 3, &f, sizeof(f));
+    REQUIRE(buf.size() == 10U);
+    CHECK(std::memcmp(buf.data(), expected, sizeof(expected)) == 0);
+    CHECK(buf[9] == 'i');
+
+    auto const out = deserialize<Mode::COMPACT, Small>(buf);
+    CHECK(out.id == 300);
+    CHECK(out.x == -2);
+    CHECK(out.f == 1.5f);
+    CHECK(out.s == String("hi"));
+}
+
+TEST_CASE("compact - round trip and size") {
+    auto t = make_telemetry();
+    auto const compact = serialize<Mode::COMPACT>(t);
+    CHECK(compact.size() == serialized_size_of<Mode::COMPACT>(t));
+    CHECK(compact.size() < serialize(t).size());
+    check_telemetry(deserialize<Mode::COMPACT, Telemetry>(compact));
+
+    constexpr auto CHECKED = Mode::COMPACT | Mode::WITH_VERSION | Mode::WITH_INTEGRITY;
+    auto checked = serialize<CHECKED>(t);
+    check_telemetry(deserialize<CHECKED, Telemetry>(checked));
+    checked[checked.size() - 1] ^= 0x01;
+    CHECK_THROWS_AS((deserialize<CHECKED, Telemetry>(checked)), DatapodException);
+
+    constexpr auto BIG = Mode::COMPACT | Mode::SERIALIZE_BIG_ENDIAN;
+    auto const big = serialize<BIG>(t);
+    CHECK(big.size() == compact.size());
+    check_telemetry(deserialize<BIG, Telemetry>(big));
+}
+
+TEST_CASE("compact - flat spans") {
+    // Float spans stay one unaligned block copy, integer spans are re-encoded
+    Vector<float> floats{1.0f, 2.0f, 3.0f};
+    auto const fbuf = serialize<Mode::COMPACT>(floats);
+    CHECK(fbuf.size() == 1U + 3U * sizeof(float));
+    CHECK(deserialize<Mode::COMPACT, Vector<float>>(fbuf) == floats);
+
+    Vector<Cell> cells;
+    for (datapod::i32 i = 0; i < 50; ++i) {
+        cells.push_back({i, -i});
+    }
+    auto const cbuf = serialize<Mode::COMPACT>(cells);
+    CHECK(cbuf.size() == 1U + 50U * 2U);
+    auto const out = deserialize<Mode::COMPACT, Vector<Cell>>(cbuf);
+    REQUIRE(out.size() == 50);
+    CHECK(out[49].x == 49);
+    CHECK(out[49].y == -49);
+
+    static_assert(is_bulk_copyable_v<Mode::COMPACT, float>);
+    static_assert(!is_bulk_copyable_v<Mode::COMPACT, Cell>);
+    static_assert(is_bulk_copyable_v<Mode::NONE, Cell>);
+}
+
+TEST_CASE("compact - malformed input") {
+    auto t = make_telemetry();
+    auto const buf = serialize<Mode::COMPACT>(t);
+
+    // Every truncation is rejected
+    for (datapod::usize n = 0; n < buf.size(); n += 7) {
+        CHECK_THROWS_AS((deserialize<Mode::COMPACT, Telemetry>(buf.data(), n)), DatapodException);
+    }
+
+    // A varint that never terminates
+    ByteBuf endless(12, 0xFF);
+    CHECK_THROWS_AS((deserialize<Mode::COMPACT, datapod::u64>(endless)), DatapodException);
+
+    // A value too wide for the destination
+    datapod::u32 wide = 70000;
+    auto const wbuf = serialize<Mode::COMPACT>(wide);
+    CHECK_THROWS_AS((deserialize<Mode::COMPACT, datapod::u16>(wbuf)), DatapodException);
+}
+
+TEST_CASE("compact - streaming, delta and parallel") {
+    auto t = make_telemetry();
+    auto const expected = serialize<Mode::COMPACT>(t);
+
+    // Fd reader decodes varints byte by byte
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    serialize_to_fd<Mode::COMPACT>(fds[1], t, 16);
+    ::close(fds[1]);
+    check_telemetry(deserialize_from_fd<Mode::COMPACT, Telemetry>(fds[0], 16));
+    ::close(fds[0]);
+
+    CHECK(serialize_parallel<Mode::COMPACT>(t) == expected);
+    check_telemetry(deserialize_parallel<Mode::COMPACT, Telemetry>(expected));
+
+    auto base = t;
+    base.id = 1;
+    base.samples[50] = -1.0f;
+    base.deltas.pop_back();
+    apply_delta<Mode::COMPACT>(base, serialize_delta<Mode::COMPACT>(base, t));
+    CHECK(serialize<Mode::COMPACT>(base) == expected);
+}
@@ -0,0 +1,174 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+using namespace datapod;
+
+// Test structs
+struct Frame {
+    datapod::u64 stamp;
+    String name;
+    Vector<float> ranges;
+    Vector<String> tags;
+    Map<datapod::u32, String> labels;
+    Array<double, 3> origin;
+};
+
+static Frame make_frame(datapod::usize n) {
+    Frame f;
+    f.stamp = 100;
+    f.name = String("scan");
+    for (datapod::usize i = 0; i < n; ++i) {
+        f.ranges.push_back(static_cast<float>(i));
+    }
+    f.tags.push_back(String("front"));
+    f.tags.push_back(String("lidar"));
+    f.labels.insert({1U, String("one")});
+    f.origin = {1.0, 2.0, 3.0};
+    return f;
+}
+
+template <Mode M = Mode::NONE, typename T> static void check_round_trip(T const &baseline, T const &current) {
+    auto patched = baseline;
+    apply_delta<M>(patched, serialize_delta<M>(baseline, current));
+    CHECK(serialize(patched) == serialize(const_cast<T &>(current)));
+}
+
+TEST_CASE("delta - identical values encode to a single tag") {
+    auto const f = make_frame(1000);
+    auto const delta = serialize_delta(f, f);
+    CHECK(delta.size() == 1U);
+
+    auto copy = f;
+    apply_delta(copy, delta);
+    CHECK(serialize(copy) == serialize(const_cast<Frame &>(f)));
+}
+
+TEST_CASE("delta - scalar and string changes") {
+    auto const base = make_frame(100);
+    auto cur = base;
+    cur.stamp = 101;
+    check_round_trip(base, cur);
+
+    cur.name = String("a much longer scan name that leaves the small buffer");
+    check_round_trip(base, cur);
+}
+
+TEST_CASE("delta - sparse vector changes cost a fraction of the full encoding") {
+    Grid<float> base;
+    base.rows = 200;
+    base.cols = 200;
+    base.resolution = 0.05;
+    base.data.resize(base.rows * base.cols);
+
+    // About 1% of the cells change, clustered as a costmap update would be
+    auto cur = base;
+    for (datapod::usize r = 100; r < 104; ++r) {
+        for (datapod::usize c = 0; c < 100; ++c) {
+            cur(r, c) = 1.0f;
+        }
+    }
+
+    auto const delta = serialize_delta(base, cur);
+    auto const full = serialize(cur);
+    CHECK(delta.size() < full.size() / 20U);
+    check_round_trip(base, cur);
+}
+
+TEST_CASE("delta - vectors grow and shrink") {
+    auto const base = make_frame(1000);
+
+    auto grown = base;
+    for (int i = 0; i < 77; ++i) {
+        grown.ranges.push_back(-1.0f);
+    }
+    grown.tags.push_back(String("rear"));
+    check_round_trip(base, grown);
+
+    auto shrunk = base;
+    shrunk.ranges.resize(10);
+    shrunk.tags.resize(1);
+    check_round_trip(base, shrunk);
+
+    auto emptied = base;
+    emptied.ranges.clear();
+    check_round_trip(base, emptied);
+    check_round_trip(emptied, base);
+}
+
+TEST_CASE("delta - nested containers and maps") {
+    auto const base = make_frame(10);
+    auto cur = base;
+    cur.tags[1] = String("radar");
+    cur.labels.insert({2U, String("two")});
+    cur.origin[2] = 4.0;
+    check_round_trip(base, cur);
+
+    Vector<Vector<datapod::u32>> a(5);
+    a[3].push_back(7);
+    auto b = a;
+    b[3].push_back(8);
+    b[1].push_back(1);
+    check_round_trip(a, b);
+}
+
+TEST_CASE("delta - robot model") {
+    robot::Model base;
+    for (int i = 0; i < 4; ++i) {
+        robot::Link l;
+        l.name = String("link");
+        base.add_link(l);
+    }
+    auto cur = base;
+    cur.links[2].name = String("gripper");
+    cur.props[String("vendor")] = String("acme");
+    check_round_trip(base, cur);
+}
+
+TEST_CASE("delta - baseline given as a serialized buffer") {
+    auto const base = make_frame(500);
+    auto cur = base;
+    cur.ranges[250] = 0.5f;
+
+    auto const base_buf = serialize<Mode::WITH_VERSION>(const_cast<Frame &>(base));
+    auto const delta = serialize_delta<Mode::WITH_VERSION>(base_buf, cur);
+    CHECK(delta == serialize_delta<Mode::WITH_VERSION>(base, cur));
+
+    auto patched = deserialize<Mode::WITH_VERSION, Frame>(base_buf);
+    apply_delta<Mode::WITH_VERSION>(patched, delta);
+    CHECK(patched.ranges[250] == 0.5f);
+}
+
+TEST_CASE("delta - headers, endianness and corruption") {
+    auto const base = make_frame(300);
+    auto cur = base;
+    cur.ranges[7] = 42.0f;
+    cur.stamp = 7;
+
+    constexpr auto MODE = Mode::WITH_INTEGRITY | Mode::WITH_VERSION;
+    check_round_trip<MODE>(base, cur);
+    check_round_trip<Mode::SERIALIZE_BIG_ENDIAN>(base, cur);
+
+    auto delta = serialize_delta<MODE>(base, cur);
+    delta[delta.size() - 1] ^= 0xFF;
+    auto patched = base;
+    CHECK_THROWS(apply_delta<MODE>(patched, delta));
+
+    auto const other = serialize_delta<Mode::WITH_VERSION>(cur.ranges, base.ranges);
+    CHECK_THROWS(apply_delta<Mode::WITH_VERSION>(patched, other));
+}
+
+TEST_CASE("delta - chunk size is configurable") {
+    Vector<datapod::u64> base(4096);
+    auto cur = base;
+    cur[0] = 1;
+    cur[4095] = 2;
+
+    auto const small = serialize_delta(base, cur, 64U);
+    auto const large = serialize_delta(base, cur, 4096U);
+    CHECK(small.size() < large.size());
+
+    auto patched = base;
+    apply_delta(patched, small);
+    CHECK(patched == cur);
+}
@@ -2,6 +2,9 @@
 
 #include "datapod/datapod.hpp"
 
+#include <cstring>
+#include <string>
+
 using namespace datapod;
 
 // Test structs
@@ -309,3 +312,43 @@ TEST_CASE("integrity - detect corruption in large data") {
 
     CHECK(caught_error == true);
 }
+
+// A corrupted length prefix is bounded by the input before anything is allocated for it
+template <Mode M, typename T> static std::string huge_length_error(T &value, datapod::usize prefix_offset) {
+    auto buf = serialize<M>(value);
+    auto const huge = datapod::usize{1} << 40U;
+    std::memcpy(buf.data() + prefix_offset, &huge, sizeof(huge)); // The outer size prefix
+
+    try {
+        (void)deserialize<M, T>(buf);
+    } catch (DatapodException const &e) {
+        return e.what();
+    }
+    return {};
+}
+
+template <typename T> static void check_huge_length_rejected(T &value) {
+    CHECK(huge_length_error<Mode::NONE>(value, 0U).find("length exceeds input") != std::string::npos);
+    CHECK(huge_length_error<Mode::WITH_INTEGRITY>(value, sizeof(hash_t)).find("integrity check failed") !=
+          std::string::npos);
+}
+
+TEST_CASE("integrity - corrupted length prefix of nested containers") {
+    Vector<Data> structs(3);
+    structs[1].values.push_back(7);
+    check_huge_length_rejected(structs);
+
+    Vector<Vector<int>> nested(4, Vector<int>{1, 2});
+    check_huge_length_rejected(nested);
+
+    Map<int, Data> map;
+    map[1].label = String("one");
+    check_huge_length_rejected(map);
+
+    struct Empty {};
+    static_assert(detail::may_encode_empty<Empty>());
+    static_assert(detail::may_encode_empty<Array<int, 0>>());
+    static_assert(!detail::may_encode_empty<Data>());
+    static_assert(!detail::may_encode_empty<Vector<Vector<int>>>());
+    static_assert(!detail::may_encode_empty<Pair<Empty, int>>());
+}
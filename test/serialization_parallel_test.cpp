@@ -0,0 +1,169 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+#include "datapod/pods/lockfree/fork_join_pool.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace datapod;
+
+// Test structs
+struct World {
+    datapod::u32 id;
+    String name;
+    Vector<double> elevation;
+    Vector<Vector<Point>> clouds;
+    Map<String, Vector<float>> channels;
+    Array<float, 4096> lut;
+    Optional<Vector<int>> extra;
+};
+
+static World make_world() {
+    World w;
+    w.id = 3;
+    w.name = String("world");
+    w.elevation.resize(300000);
+    for (datapod::usize i = 0; i < w.elevation.size(); ++i) {
+        w.elevation[i] = static_cast<double>(i) * 0.1;
+    }
+    for (int c = 0; c < 40; ++c) {
+        Vector<Point> cloud(static_cast<datapod::usize>(c) * 100U);
+        for (datapod::usize i = 0; i < cloud.size(); ++i) {
+            cloud[i] = Point{static_cast<double>(i), static_cast<double>(c), 1.0};
+        }
+        w.clouds.push_back(cloud);
+    }
+    for (int c = 0; c < 20; ++c) {
+        Vector<float> values(5000);
+        values[4999] = static_cast<float>(c);
+        w.channels[String(("ch" + std::to_string(c)).c_str())] = values;
+    }
+    for (datapod::usize i = 0; i < w.lut.size(); ++i) {
+        w.lut[i] = static_cast<float>(i);
+    }
+    w.extra = Vector<int>(10000, 7);
+    return w;
+}
+
+static void check_world(World const &w) {
+    CHECK(w.id == 3);
+    CHECK(w.name == String("world"));
+    REQUIRE(w.elevation.size() == 300000);
+    CHECK(w.elevation[299999] == 299999 * 0.1);
+    REQUIRE(w.clouds.size() == 40);
+    CHECK(w.clouds[39].size() == 3900);
+    CHECK(w.clouds[39][3899].x == 3899.0);
+    CHECK(w.channels.size() == 20);
+    CHECK(w.channels.at(String("ch17"))[4999] == 17.0f);
+    CHECK(w.lut[4095] == 4095.0f);
+    REQUIRE(w.extra.has_value());
+    CHECK((*w.extra)[9999] == 7);
+}
+
+// Encoded from a temporary that is scrubbed as soon as it has been written
+struct Generated {
+    datapod::u32 n;
+};
+
+template <Mode M, typename Ctx> void serialize(Ctx &ctx, Generated &g) {
+    Vector<float> samples(g.n, 1.5f);
+    serialize<M>(ctx, samples);
+    std::fill(samples.begin(), samples.end(), 0.0f);
+}
+
+// Executor running every task inline, in reverse order
+struct ReverseExecutor {
+    template <typename Task> void operator()(datapod::usize n, Task const &task) const {
+        while (n != 0U) {
+            task(--n);
+        }
+    }
+};
+
+TEST_CASE("parallel - output is byte-identical to serialize()") {
+    auto w = make_world();
+    auto const expected = serialize(w);
+    CHECK(serialize_parallel(w) == expected);
+    CHECK(serialize_parallel(w, ThreadExecutor{4}) == expected);
+    CHECK(serialize_parallel(w, ReverseExecutor{}) == expected);
+
+    constexpr auto MODE = Mode::WITH_INTEGRITY | Mode::WITH_VERSION;
+    CHECK(serialize_parallel<MODE>(w, ThreadExecutor{3}) == serialize<MODE>(w));
+    CHECK(serialize_parallel<Mode::SERIALIZE_BIG_ENDIAN>(w) == serialize<Mode::SERIALIZE_BIG_ENDIAN>(w));
+}
+
+TEST_CASE("parallel - deserialize round trip") {
+    auto w = make_world();
+    check_world(deserialize_parallel<Mode::NONE, World>(serialize(w)));
+    check_world(deserialize_parallel<Mode::NONE, World>(serialize(w), ReverseExecutor{}));
+
+    constexpr auto MODE = Mode::WITH_INTEGRITY | Mode::WITH_VERSION;
+    auto const buf = serialize_parallel<MODE>(w, ThreadExecutor{4});
+    check_world(deserialize_parallel<MODE, World>(buf, ThreadExecutor{4}));
+    check_world(deserialize<MODE, World>(buf));
+
+    auto const be = serialize<Mode::SERIALIZE_BIG_ENDIAN>(w);
+    check_world(deserialize_parallel<Mode::SERIALIZE_BIG_ENDIAN, World>(be));
+}
+
+TEST_CASE("parallel - multi series columns") {
+    MultiSeries ms;
+    for (int64_t t = 0; t < 20000; ++t) {
+        ms.timestamps.push_back(t);
+    }
+    for (int c = 0; c < 50; ++c) {
+        Vector<double> column(ms.timestamps.size(), static_cast<double>(c));
+        ms.series[String(("col" + std::to_string(c)).c_str())] = column;
+    }
+
+    auto const buf = serialize_parallel(ms, ThreadExecutor{4});
+    CHECK(buf == serialize(ms));
+
+    auto const back = deserialize_parallel<Mode::NONE, MultiSeries>(buf, ThreadExecutor{4});
+    CHECK(back.timestamps.size() == 20000);
+    CHECK(back.series.size() == 50);
+    CHECK(back.series.at(String("col42"))[19999] == 42.0);
+}
+
+TEST_CASE("parallel - ForkJoinPool as the executor") {
+    auto w = make_world();
+    ForkJoinPool pool{4};
+    auto const buf = serialize_parallel(w, pool);
+    CHECK(buf == serialize(w));
+    check_world(deserialize_parallel<Mode::NONE, World>(buf, pool));
+}
+
+TEST_CASE("parallel - temporaries written by custom overloads are copied right away") {
+    Generated g{10000};
+    auto const buf = serialize_parallel(g, ReverseExecutor{});
+    CHECK(buf == serialize(g));
+    CHECK(deserialize<Mode::NONE, Vector<float>>(buf)[9999] == 1.5f);
+}
+
+TEST_CASE("parallel - small and empty values") {
+    int i = 5;
+    CHECK(serialize_parallel(i) == serialize(i));
+    CHECK(deserialize_parallel<Mode::NONE, int>(serialize(i)) == 5);
+
+    Vector<Vector<Point>> empty;
+    CHECK(serialize_parallel(empty) == serialize(empty));
+    CHECK(deserialize_parallel<Mode::NONE, Vector<Vector<Point>>>(serialize(empty)).empty());
+}
+
+TEST_CASE("parallel - corrupted input is rejected") {
+    auto w = make_world();
+    auto buf = serialize<Mode::WITH_INTEGRITY>(w);
+    buf[buf.size() / 2] ^= 0xFF;
+    CHECK_THROWS(deserialize_parallel<Mode::WITH_INTEGRITY, World>(buf));
+
+    auto truncated = serialize(w);
+    truncated.resize(truncated.size() / 2);
+    CHECK_THROWS(deserialize_parallel<Mode::NONE, World>(truncated));
+
+    // A huge outer length is rejected before the rows are allocated
+    auto rows = serialize(w.clouds);
+    auto const huge = datapod::usize{1} << 40U;
+    std::memcpy(rows.data(), &huge, sizeof(huge));
+    CHECK_THROWS_AS((deserialize_parallel<Mode::NONE, Vector<Vector<Point>>>(rows)), DatapodException);
+}
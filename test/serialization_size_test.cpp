@@ -0,0 +1,80 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+using namespace datapod;
+
+// Test structs
+struct Mixed {
+    datapod::u8 tag;
+    double value;
+    String label;
+    Vector<datapod::u16> samples;
+    Optional<int> extra;
+};
+
+struct Nested {
+    Vector<Mixed> items;
+    Map<datapod::u32, String> names;
+    datapod::u8 trailer;
+};
+
+TEST_CASE("serialized_size_of - scalars and strings") {
+    int i = 7;
+    CHECK(serialized_size_of(i) == serialize(i).size());
+
+    String s("hello world");
+    CHECK(serialized_size_of(s) == sizeof(datapod::usize) + 11);
+    CHECK(serialized_size_of(s) == serialize(s).size());
+}
+
+TEST_CASE("serialized_size_of - matches serialize() including padding") {
+    Mixed m{3, 2.5, String("label"), {1, 2, 3}, 42};
+    CHECK(serialized_size_of(m) == serialize(m).size());
+
+    Nested n;
+    n.items.push_back(m);
+    n.items.push_back(Mixed{1, 0.5, String("x"), {}, {}});
+    n.names.insert({1, String("one")});
+    n.names.insert({2, String("two")});
+    n.trailer = 9;
+    CHECK(serialized_size_of(n) == serialize(n).size());
+}
+
+TEST_CASE("serialized_size_of - accounts for mode headers") {
+    Mixed m{3, 2.5, String("label"), {1, 2, 3}, 42};
+
+    CHECK(serialized_size_of<Mode::WITH_VERSION>(m) == serialize<Mode::WITH_VERSION>(m).size());
+    CHECK(serialized_size_of<Mode::WITH_INTEGRITY>(m) == serialize<Mode::WITH_INTEGRITY>(m).size());
+    CHECK(serialized_size_of<Mode::WITH_VERSION | Mode::WITH_INTEGRITY>(m) ==
+          serialize<Mode::WITH_VERSION | Mode::WITH_INTEGRITY>(m).size());
+    CHECK(serialized_size_of<Mode::SERIALIZE_BIG_ENDIAN>(m) == serialize<Mode::SERIALIZE_BIG_ENDIAN>(m).size());
+    CHECK(serialized_size_of<Mode::WITH_VERSION>(m) == serialized_size_of(m) + sizeof(hash_t));
+}
+
+TEST_CASE("serialized_size_of - pre-sized buffer is filled without growing") {
+    Vector<Point> points(100);
+    String name("cloud");
+
+    auto b = Buf{};
+    b.allocate(serialized_size_of(points) + serialized_size_of(name));
+    auto const *storage = b.buf_.data();
+
+    auto ctx = SerializationContext<Buf<ByteBuf>, Mode::NONE>{b};
+    serialize<Mode::NONE>(ctx, points);
+    serialize<Mode::NONE>(ctx, name);
+
+    CHECK(b.buf_.data() == storage);
+    CHECK(b.size() == b.buf_.size());
+}
+
+TEST_CASE("serialized_size_of - round trip after single allocation") {
+    Mixed m{3, 2.5, String("label"), {1, 2, 3}, 42};
+    auto buf = serialize<Mode::WITH_INTEGRITY>(m);
+
+    auto result = deserialize<Mode::WITH_INTEGRITY, Mixed>(buf);
+    CHECK(result.tag == 3);
+    CHECK(result.label == String("label"));
+    CHECK(result.samples.size() == 3);
+    CHECK(*result.extra == 42);
+}
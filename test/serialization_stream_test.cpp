@@ -0,0 +1,214 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace datapod;
+
+// Test structs
+struct Occupancy {
+    datapod::u32 id;
+    String frame;
+    Vector<float> cells;
+    Map<datapod::u32, String> labels;
+};
+
+static Occupancy make_occupancy(datapod::usize n) {
+    Occupancy o;
+    o.id = 7;
+    o.frame = String("map");
+    o.cells.resize(n);
+    for (datapod::usize i = 0; i < n; ++i) {
+        o.cells[i] = static_cast<float>(i) * 0.5f;
+    }
+    for (datapod::u32 i = 0; i < 20; ++i) {
+        o.labels.insert({i, String("region")});
+    }
+    return o;
+}
+
+static void check_occupancy(Occupancy const &o, datapod::usize n) {
+    CHECK(o.id == 7);
+    CHECK(o.frame == String("map"));
+    REQUIRE(o.cells.size() == n);
+    CHECK(o.cells[n - 1] == static_cast<float>(n - 1) * 0.5f);
+    CHECK(o.labels.size() == 20);
+}
+
+static ByteBuf read_file(char const *path) {
+    ByteBuf out;
+    auto f = std::fopen(path, "rb");
+    REQUIRE(f != nullptr);
+    int c;
+    while ((c = std::fgetc(f)) != EOF) {
+        out.push_back(static_cast<datapod::u8>(c));
+    }
+    std::fclose(f);
+    return out;
+}
+
+template <Mode M> static void check_fd_round_trip(datapod::usize capacity) {
+    auto const path = "datapod_stream_test.bin";
+    auto o = make_occupancy(10000);
+
+    auto fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    REQUIRE(fd != -1);
+    serialize_to_fd<M>(fd, o, capacity);
+    ::close(fd);
+
+    // Byte-identical to the in-memory encoding
+    CHECK(read_file(path) == serialize<M>(o));
+
+    fd = ::open(path, O_RDONLY);
+    REQUIRE(fd != -1);
+    auto result = deserialize_from_fd<M, Occupancy>(fd, capacity);
+    ::close(fd);
+    check_occupancy(result, 10000);
+
+    std::remove(path);
+}
+
+TEST_CASE("stream - fd round trip") {
+    check_fd_round_trip<Mode::NONE>(FdBuf::DEFAULT_CAPACITY);
+    check_fd_round_trip<Mode::WITH_VERSION>(FdBuf::DEFAULT_CAPACITY);
+    check_fd_round_trip<Mode::WITH_INTEGRITY | Mode::WITH_VERSION>(FdBuf::DEFAULT_CAPACITY);
+}
+
+TEST_CASE("stream - tiny staging buffer") {
+    // Exercises both the staged path and the large-write bypass
+    check_fd_round_trip<Mode::NONE>(16);
+    check_fd_round_trip<Mode::WITH_INTEGRITY>(16);
+    check_fd_round_trip<Mode::WITH_INTEGRITY>(1);
+}
+
+TEST_CASE("stream - corrupted stream fails the integrity check") {
+    auto const path = "datapod_stream_corrupt.bin";
+    auto o = make_occupancy(100);
+    auto buf = serialize<Mode::WITH_INTEGRITY>(o);
+    buf[buf.size() - 1] ^= 0xFF;
+    {
+        auto f = std::fopen(path, "wb");
+        std::fwrite(buf.data(), 1, buf.size(), f);
+        std::fclose(f);
+    }
+
+    auto fd = ::open(path, O_RDONLY);
+    REQUIRE(fd != -1);
+    CHECK_THROWS(deserialize_from_fd<Mode::WITH_INTEGRITY, Occupancy>(fd, 64));
+    ::close(fd);
+    std::remove(path);
+}
+
+TEST_CASE("stream - truncated stream throws") {
+    auto const path = "datapod_stream_truncated.bin";
+    auto o = make_occupancy(100);
+    auto buf = serialize(o);
+    {
+        auto f = std::fopen(path, "wb");
+        std::fwrite(buf.data(), 1, buf.size() / 2, f);
+        std::fclose(f);
+    }
+
+    auto fd = ::open(path, O_RDONLY);
+    REQUIRE(fd != -1);
+    CHECK_THROWS(deserialize_from_fd<Mode::NONE, Occupancy>(fd));
+    ::close(fd);
+    std::remove(path);
+}
+
+TEST_CASE("stream - corrupted length prefix is bounded by the file size") {
+    auto const path = "datapod_stream_length.bin";
+    Vector<Vector<float>> rows(8, Vector<float>{1.0f, 2.0f});
+    auto buf = serialize(rows);
+    auto const huge = datapod::usize{1} << 40U;
+    std::memcpy(buf.data(), &huge, sizeof(huge)); // Outer size prefix
+    {
+        auto f = std::fopen(path, "wb");
+        std::fwrite(buf.data(), 1, buf.size(), f);
+        std::fclose(f);
+    }
+
+    // Rejected before the outer vector allocates room for 2^40 rows
+    auto fd = ::open(path, O_RDONLY);
+    REQUIRE(fd != -1);
+    std::string message;
+    try {
+        (void)deserialize_from_fd<Mode::NONE, Vector<Vector<float>>>(fd);
+    } catch (DatapodException const &e) {
+        message = e.what();
+    }
+    CHECK(message.find("length exceeds input") != std::string::npos);
+    ::close(fd);
+    std::remove(path);
+}
+
+template <Mode M> static void check_back_to_back(datapod::usize capacity) {
+    auto const path = "datapod_stream_back_to_back.bin";
+    auto first = make_occupancy(1000);
+    auto second = make_occupancy(300);
+    second.id = 8;
+
+    auto fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    REQUIRE(fd != -1);
+    serialize_to_fd<M>(fd, first, capacity);
+    serialize_to_fd<M>(fd, second, capacity);
+    datapod::u32 const trailer = 0xABCD1234U;
+    REQUIRE(::write(fd, &trailer, sizeof(trailer)) == sizeof(trailer));
+
+    // Each read leaves the fd right after its message, trailing bytes included
+    REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+    check_occupancy(deserialize_from_fd<M, Occupancy>(fd, capacity), 1000);
+    CHECK(::lseek(fd, 0, SEEK_CUR) == static_cast<off_t>(serialize<M>(first).size()));
+    auto const result = deserialize_from_fd<M, Occupancy>(fd, capacity);
+    CHECK(result.id == 8);
+    CHECK(result.cells.size() == 300);
+    datapod::u32 rest = 0;
+    CHECK(::read(fd, &rest, sizeof(rest)) == sizeof(rest));
+    CHECK(rest == trailer);
+    ::close(fd);
+    std::remove(path);
+}
+
+TEST_CASE("stream - back to back messages in one file") {
+    check_back_to_back<Mode::NONE>(FdDeserializationContext<Mode::NONE>::DEFAULT_CAPACITY);
+    check_back_to_back<Mode::WITH_INTEGRITY | Mode::WITH_VERSION>(
+        FdDeserializationContext<Mode::WITH_INTEGRITY | Mode::WITH_VERSION>::DEFAULT_CAPACITY);
+    check_back_to_back<Mode::WITH_INTEGRITY>(16);
+}
+
+TEST_CASE("stream - pipe without integrity") {
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+
+    // Small enough to fit in the pipe buffer without a reader thread
+    auto o = make_occupancy(256);
+    serialize_to_fd<Mode::WITH_VERSION>(fds[1], o, 128);
+    ::close(fds[1]);
+
+    auto result = deserialize_from_fd<Mode::WITH_VERSION, Occupancy>(fds[0], 128);
+    ::close(fds[0]);
+    check_occupancy(result, 256);
+}
+
+TEST_CASE("stream - mmap file target") {
+    auto const path = "datapod_stream_mmap.bin";
+    auto o = make_occupancy(5000);
+    serialize_to_file<Mode::WITH_INTEGRITY>(path, o);
+
+    auto const file = read_file(path);
+    CHECK(file == serialize<Mode::WITH_INTEGRITY>(o));
+    check_occupancy(deserialize<Mode::WITH_INTEGRITY, Occupancy>(file), 5000);
+
+    // Buf<Mmap> also works as a plain target
+    {
+        auto b = Buf{Mmap{path, Mmap::Protection::WRITE}};
+        serialize_to<Mode::NONE>(b, o);
+    }
+    check_occupancy(deserialize<Mode::NONE, Occupancy>(read_file(path)), 5000);
+    std::remove(path);
+}
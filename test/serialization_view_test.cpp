@@ -0,0 +1,172 @@
+#include <doctest/doctest.h>
+
+#include "datapod/datapod.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace datapod;
+
+// Test structs
+struct Waypoint {
+    double x;
+    double y;
+    offset::String name;
+};
+
+struct Snapshot {
+    datapod::u32 id;
+    offset::String title;
+    offset::Vector<Waypoint> route;
+    offset::Map<datapod::u32, offset::String> labels;
+    offset::Set<datapod::u64> visited;
+    Array<float, 3> origin;
+};
+
+struct RawSnapshot {
+    datapod::u32 id;
+    Vector<int> values;
+};
+
+static Snapshot make_snapshot() {
+    Snapshot s;
+    s.id = 42;
+    s.title = offset::String("a title long enough to leave the small string buffer");
+    for (int i = 0; i < 100; ++i) {
+        s.route.push_back(Waypoint{i * 1.0, i * 2.0, offset::String(i % 2 == 0 ? "short" : "a much longer waypoint name")});
+    }
+    for (datapod::u32 i = 0; i < 50; ++i) {
+        s.labels.insert({i, offset::String("label")});
+        s.visited.insert(i * 3U);
+    }
+    s.origin = {1.0f, 2.0f, 3.0f};
+    return s;
+}
+
+static void check_snapshot(Snapshot const &v) {
+    CHECK(v.id == 42);
+    CHECK(v.title.view() == "a title long enough to leave the small string buffer");
+    REQUIRE(v.route.size() == 100);
+    CHECK(v.route[0].name.view() == "short");
+    CHECK(v.route[99].x == 99.0);
+    CHECK(v.route[99].name.view() == "a much longer waypoint name");
+    CHECK(v.labels.size() == 50);
+    REQUIRE(v.labels.find(7U) != v.labels.end());
+    CHECK(v.labels.find(7U)->second.view() == "label");
+    CHECK(v.labels.find(77U) == v.labels.end());
+    CHECK(v.visited.contains(147U));
+    CHECK_FALSE(v.visited.contains(148U));
+    CHECK(v.origin[2] == 3.0f);
+}
+
+TEST_CASE("view - offset containers are usable in memory") {
+    offset::Vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(i);
+    }
+    auto moved = std::move(v);
+    CHECK(moved.size() == 10);
+    CHECK(moved[9] == 9);
+
+    offset::String s("this string is definitely on the heap");
+    auto copy = s;
+    CHECK(copy == s);
+    copy.swap(s);
+    CHECK(s.size() == copy.size());
+
+    offset::Map<int, int> m;
+    m[1] = 10;
+    m[2] = 20;
+    CHECK(m.at(2) == 20);
+}
+
+TEST_CASE("view - compatibility trait") {
+    CHECK(is_view_compatible_v<Snapshot>);
+    CHECK(is_view_compatible_v<offset::Vector<Point>>);
+    CHECK_FALSE(is_view_compatible_v<String>);
+    CHECK_FALSE(is_view_compatible_v<Vector<int>>);
+    CHECK_FALSE(is_view_compatible_v<RawSnapshot>);
+}
+
+TEST_CASE("view - round trip without decoding") {
+    auto const s = make_snapshot();
+    auto buf = serialize_view(s);
+
+    auto const *v = view<Mode::NONE, Snapshot>(buf);
+    REQUIRE(v != nullptr);
+    CHECK(reinterpret_cast<datapod::u8 const *>(v) == buf.data());
+    check_snapshot(*v);
+
+    // Pointers resolve inside the buffer, not back into the source object
+    CHECK(v->route.data() > reinterpret_cast<Waypoint const *>(buf.data()));
+    CHECK(reinterpret_cast<datapod::u8 const *>(v->route.data()) < buf.data() + buf.size());
+}
+
+TEST_CASE("view - buffer is relocatable") {
+    auto buf = serialize_view(make_snapshot());
+    auto moved = ByteBuf(buf.begin(), buf.end());
+    std::memset(buf.data(), 0, buf.size());
+
+    check_snapshot(*view<Mode::DEEP_CHECK, Snapshot>(moved));
+}
+
+TEST_CASE("view - headers and deep check") {
+    auto const s = make_snapshot();
+    constexpr auto MODE = Mode::WITH_INTEGRITY | Mode::WITH_VERSION | Mode::DEEP_CHECK;
+    auto buf = serialize_view<MODE>(s);
+    check_snapshot(*view<MODE, Snapshot>(buf));
+
+    auto corrupted = buf;
+    corrupted[corrupted.size() / 2] ^= 0xFF;
+    CHECK_THROWS(view<MODE, Snapshot>(corrupted));
+
+    CHECK_THROWS(view<Mode::WITH_VERSION, Waypoint>(serialize_view<Mode::WITH_VERSION>(s)));
+}
+
+TEST_CASE("view - version hash covers the hash table group width") {
+    // Images dump control bytes, so their version hash depends on HashStorage::WIDTH; serialize() does not
+    CHECK(detail::view_group_width<Snapshot>() == offset::Set<datapod::u64>::WIDTH);
+    CHECK(detail::view_type_hash<Snapshot>() != type_hash<Snapshot>());
+    CHECK(detail::view_group_width<Waypoint>() == 0U);
+    CHECK(detail::view_type_hash<Waypoint>() == type_hash<Waypoint>());
+}
+
+TEST_CASE("view - deep check rejects out of bounds offsets") {
+    offset::Vector<datapod::u64> v;
+    v.push_back(1);
+    v.push_back(2);
+    auto buf = serialize_view(v);
+
+    // Claim more elements than the buffer holds
+    auto const big = datapod::usize{1} << 40U;
+    std::memcpy(buf.data() + sizeof(offset_t), &big, sizeof(big));
+    CHECK_THROWS(view<Mode::DEEP_CHECK, offset::Vector<datapod::u64>>(buf));
+
+    CHECK_THROWS(view<Mode::NONE, offset::Vector<datapod::u64>>(buf.data(), 4U));
+}
+
+TEST_CASE("view - mmap snapshot") {
+    auto const path = "datapod_view_test.bin";
+    auto const buf = serialize_view<Mode::WITH_VERSION>(make_snapshot());
+    {
+        auto f = std::fopen(path, "wb");
+        REQUIRE(f != nullptr);
+        std::fwrite(buf.data(), 1, buf.size(), f);
+        std::fclose(f);
+    }
+    {
+        Mmap m{path, Mmap::Protection::READ};
+        check_snapshot(*view<Mode::WITH_VERSION, Snapshot>(m));
+    }
+    std::remove(path);
+}
+
+TEST_CASE("view - empty containers") {
+    Snapshot s{};
+    auto buf = serialize_view(s);
+    auto const *v = view<Mode::DEEP_CHECK, Snapshot>(buf);
+    CHECK(v->route.empty());
+    CHECK(v->labels.empty());
+    CHECK(v->labels.find(1U) == v->labels.end());
+    CHECK(v->title.empty());
+}
@@ -314,3 +314,112 @@ TEST_CASE("primitive_type_id - names are correct") {
     CHECK(std::string_view(primitive_type_id<f64>::name) == "f64");
     CHECK(std::string_view(primitive_type_id<boolean>::name) == "boolean");
 }
+
+// ============================================================================
+// Compile-time Type Hash Tests
+// ============================================================================
+
+struct SelfRef {
+    int value;
+    SelfRef *next;
+};
+
+struct Everything {
+    SimpleStruct simple;
+    SimpleStruct again;
+    String name;
+    Vector<NestedStruct> nested;
+    Map<u32, String> names;
+    Optional<double> maybe;
+    Pair<int, float> pair;
+    Array<u8, 4> bytes;
+    Variant<int, String> either;
+    SelfRef *list;
+};
+
+class NotReflectable {
+  public:
+    int get() const { return v_; }
+
+  private:
+    int v_{0};
+};
+
+hash_t type_hash(NotReflectable const &, hash_t h, Map<hash_t, unsigned> &) noexcept {
+    return hash_combine(h, hash("not_reflectable"));
+}
+
+// Reflectable, but hashed by its own overload
+struct Calibrated {
+    double gain;
+    double offset;
+};
+
+hash_t type_hash(Calibrated const &, hash_t h, Map<hash_t, unsigned> &) noexcept {
+    return hash_combine(h, hash("calibrated"));
+}
+
+struct WithCalibrated {
+    int id;
+    Calibrated calibration;
+};
+
+template <typename T> static hash_t runtime_type_hash() {
+    auto done = Map<hash_t, unsigned>{};
+    return type_hash(T{}, BASE_HASH, done);
+}
+
+TEST_CASE("type_hash - canonical name is computed at compile time") {
+    static_assert(canonical_type_name_v<int>.view() == "int");
+    CHECK(canonical_type_str<SimpleStruct>() == std::string(canonical_type_name_v<SimpleStruct>.view()));
+    CHECK(canonical_type_str<Vector<int const *>>().find("const") == std::string::npos);
+
+    // Same result as canonicalizing the runtime string
+    auto legacy = std::string(type_str<Map<u32, Vector<char const *>>>());
+    canonicalize_type_name(legacy);
+    CHECK(legacy == canonical_type_str<Map<u32, Vector<char const *>>>());
+}
+
+TEST_CASE("type_hash - static hash is a constant expression") {
+    static_assert(is_static_type_hashable_v<Everything>);
+    static_assert(type_hash_v<int> != type_hash_v<double>);
+    constexpr auto h = static_type_hash<NestedStruct>();
+    CHECK(h == type_hash<NestedStruct>());
+}
+
+TEST_CASE("type_hash - static walk matches the runtime walk") {
+    CHECK(type_hash_v<int> == runtime_type_hash<int>());
+    CHECK(type_hash_v<void *> == runtime_type_hash<void *>());
+    CHECK(type_hash_v<SimpleStruct> == runtime_type_hash<SimpleStruct>());
+    CHECK(type_hash_v<NestedStruct> == runtime_type_hash<NestedStruct>());
+    CHECK(type_hash_v<WithPointer> == runtime_type_hash<WithPointer>());
+    CHECK(type_hash_v<WithString> == runtime_type_hash<WithString>());
+    CHECK(type_hash_v<WithVector> == runtime_type_hash<WithVector>());
+    CHECK(type_hash_v<WithOptional> == runtime_type_hash<WithOptional>());
+    CHECK(type_hash_v<SelfRef> == runtime_type_hash<SelfRef>());
+    CHECK(type_hash_v<Everything> == runtime_type_hash<Everything>());
+    CHECK(type_hash_v<Tuple<int, double>> == runtime_type_hash<Tuple<int, double>>());
+    CHECK(type_hash_v<UniquePtr<int>> == runtime_type_hash<UniquePtr<int>>());
+    CHECK(type_hash_v<Set<u64>> == runtime_type_hash<Set<u64>>());
+    CHECK(type_hash_v<Point> == runtime_type_hash<Point>());
+
+    struct Tag {};
+    CHECK(type_hash_v<Strong<int, Tag>> == runtime_type_hash<Strong<int, Tag>>());
+}
+
+TEST_CASE("type_hash - non-reflectable types fall back to a cached runtime walk") {
+    static_assert(!is_static_type_hashable_v<NotReflectable>);
+    CHECK(type_hash<NotReflectable>() == type_hash<NotReflectable>());
+    CHECK(type_hash<NotReflectable>() == hash_combine(BASE_HASH, hash("not_reflectable")));
+}
+
+TEST_CASE("type_hash - custom overloads of reflectable types are honored") {
+    static_assert(!is_static_type_hashable_v<Calibrated>);
+    static_assert(!is_static_type_hashable_v<WithCalibrated>);
+    static_assert(!is_static_type_hashable_v<Vector<Calibrated>>);
+    static_assert(is_static_type_hashable_v<Point>);
+
+    CHECK(type_hash<Calibrated>() == hash_combine(BASE_HASH, hash("calibrated")));
+    CHECK(type_hash<WithCalibrated>() == runtime_type_hash<WithCalibrated>());
+    CHECK(type_hash<WithCalibrated>() != type_hash<Pair<int, Pair<double, double>>>());
+}